@@ -0,0 +1,205 @@
+// Bytes and CPU time per sample: the old DynamicJsonDocument + serializeJson line against SampleLogEncoder,
+// and the version 2 block codec on synthetic samples and on a recorded CSV (the ADC columns of
+// tools/mapped_sensors.csv by default). Needs ArduinoJson, built by CMake next to smc_host.
+// logformat_bench [dataset.csv]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "../../src/pipeline/deadband.h"
+#include "../../src/pipeline/sample_codec.h"
+#include "../../src/pipeline/sample_log.h"
+
+static const size_t SAMPLES = 200000;
+static const size_t PERIODS[] = {37, 23, 11, 7, 5, 3, 2, 1};
+
+static SensorSample makeSample(size_t i) {
+    SensorSample s;
+    s.timestamp = 1752451200u + (uint32_t)(i * 4 / 3);
+    forEachChannel([&](auto c) { s.values[c] = (uint16_t)(1200 + 300 * c + i % PERIODS[c]); });
+    return s;
+}
+
+// what SensorLoggingService::logSample() did per sample, written into a reused String instead of a File
+static void benchJson() {
+    String out;
+    out.reserve(128);
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        SensorSample sample = makeSample(i);
+        DynamicJsonDocument doc(512);
+        doc["timestamp"] = sample.timestamp;
+        forEachChannel([&](auto c) { doc[SENSOR_CHANNELS[c].name] = sample.values[c]; });
+        out = String();
+        serializeJson(doc, out);
+        out += '\n';
+        bytes += out.length();
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    printf("json lines      %6.1f bytes/sample  %7.1f ns/sample\n", (double)bytes / SAMPLES, ns / SAMPLES);
+}
+
+static void benchBinary() {
+    SensorSample batch[PIPELINE_BATCH_SIZE];
+    uint8_t records[PIPELINE_BATCH_SIZE * SAMPLE_LOG_RECORD_SIZE];
+    size_t bytes = 0;
+    volatile uint8_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < SAMPLES; i += PIPELINE_BATCH_SIZE) {
+        for (size_t j = 0; j < PIPELINE_BATCH_SIZE; ++j)
+            batch[j] = makeSample(i + j);
+        bytes += SampleLogEncoder::encodeBatch(batch, PIPELINE_BATCH_SIZE, records);
+        sink = sink + records[0];
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    printf("binary v1       %6.1f bytes/sample  %7.1f ns/sample\n", (double)bytes / SAMPLES, ns / SAMPLES);
+}
+
+// blocks of blockSamples (a commit's worth in the firmware), then a full decode that has to give back every sample
+static bool benchBlocks(const char* label, const std::vector<SensorSample>& samples, uint16_t blockSamples) {
+    SampleBlockEncoder encoder;
+    encoder.begin(SENSOR_CHANNEL_COUNT, blockSamples);
+    std::vector<uint8_t> out(samples.size() * SAMPLE_LOG_RECORD_SIZE + SAMPLE_BLOCK_MAX_SIZE);
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const SensorSample& sample : samples) {
+        if (!encoder.fits(sample.timestamp))
+            bytes += encoder.finish(out.data() + bytes);
+        encoder.add(sample);
+    }
+    bytes += encoder.finish(out.data() + bytes);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    SampleLogHeader header;
+    header.channelCount = SENSOR_CHANNEL_COUNT;
+    uint32_t timestamps[SAMPLE_BLOCK_MAX_SAMPLES];
+    uint16_t values[SAMPLE_BLOCK_MAX_SAMPLES * SENSOR_CHANNEL_COUNT];
+    size_t decoded = 0, offset = 0, length;
+    bool same = true;
+    start = std::chrono::steady_clock::now();
+    while ((length = SampleBlockDecoder::blockSize(header, out.data() + offset, bytes - offset)) > 0) {
+        uint16_t n = SampleBlockDecoder::decode(header, out.data() + offset, length, timestamps, values);
+        for (uint16_t i = 0; i < n && decoded + i < samples.size(); ++i) {
+            const SensorSample& s = samples[decoded + i];
+            same = same && timestamps[i] == s.timestamp &&
+                   memcmp(values + SENSOR_CHANNEL_COUNT * i, s.values, sizeof(s.values)) == 0;
+        }
+        decoded += n;
+        offset += length;
+    }
+    double decodeNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    same = same && decoded == samples.size();
+
+    printf("%-15s %6.2f bytes/sample  %7.1f ns/sample  %4.1fx smaller than v1, decode %5.1f ns/sample%s\n", label,
+           (double)bytes / samples.size(), ns / samples.size(),
+           (double)samples.size() * SAMPLE_LOG_RECORD_SIZE / bytes, decodeNs / samples.size(),
+           same ? "" : "  ROUND TRIP FAILED");
+    return same;
+}
+
+// change triggered logging at one deadband for every channel: how many samples and bytes remain, how far a held
+// value strays from the samples it stands for, and how many samples HeldSampleFiller gives back
+static bool benchDeadband(const std::vector<SensorSample>& samples, uint8_t deadband, uint16_t heartbeat) {
+    SampleLogHeader header;
+    SampleLogEncoder::describeChannels(header);
+    header.samplePeriodMs = 1332;
+    for (uint8_t c = 0; c < header.channelCount; ++c) {
+        header.channels[c].deadband = deadband;
+        header.channels[c].heartbeatSeconds = heartbeat;
+    }
+    DeadbandFilter filter;
+    filter.begin(header);
+    SampleBlockEncoder encoder;
+    encoder.begin(SENSOR_CHANNEL_COUNT, 45);
+    uint8_t block[SAMPLE_BLOCK_MAX_SIZE];
+    std::vector<SensorSample> kept;
+    size_t bytes = 0;
+    int worst = 0;
+    for (const SensorSample& sample : samples) {
+        if (filter.keep(sample)) {
+            kept.push_back(sample);
+            if (!encoder.fits(sample.timestamp))
+                bytes += encoder.finish(block);
+            encoder.add(sample);
+            continue;
+        }
+        for (size_t c = 0; c < SENSOR_CHANNEL_COUNT; ++c) {
+            int error = abs((int)sample.values[c] - (int)kept.back().values[c]);
+            worst = error > worst ? error : worst;
+        }
+    }
+    bytes += encoder.finish(block);
+
+    HeldSampleFiller filler;
+    filler.begin(header);
+    size_t filled = 0;
+    for (const SensorSample& s : kept)
+        filler.add(s.timestamp, s.values, [&](uint32_t, const uint16_t*) { filled++; });
+
+    printf("deadband %3u    %6.2f bytes/sample  %5.1f%% of samples logged, %zu bytes, held values off by <= %d, "
+           "%zu samples filled back\n",
+           deadband, (double)bytes / samples.size(), 100.0 * kept.size() / samples.size(), bytes, worst, filled);
+    return worst <= deadband;
+}
+
+// the first SENSOR_CHANNEL_COUNT value columns of every complete row, timestamps in nanoseconds as pandas
+// writes them
+static std::vector<SensorSample> loadCsv(const char* path) {
+    std::vector<SensorSample> samples;
+    FILE* f = fopen(path, "r");
+    if (!f)
+        return samples;
+    char line[512];
+    if (fgets(line, sizeof(line), f)) {
+        while (fgets(line, sizeof(line), f)) {
+            char* p = line;
+            char* end;
+            unsigned long long ns = strtoull(p, &end, 10);
+            if (end == p)
+                continue;
+            SensorSample s;
+            s.timestamp = (uint32_t)(ns / 1000000000ull);
+            size_t c = 0;
+            for (; c < SENSOR_CHANNEL_COUNT && *end == ','; ++c) {
+                p = end + 1;
+                s.values[c] = (uint16_t)strtoul(p, &end, 10);
+                if (end == p)
+                    break;
+            }
+            if (c == SENSOR_CHANNEL_COUNT)
+                samples.push_back(s);
+        }
+    }
+    fclose(f);
+    return samples;
+}
+
+int main(int argc, char** argv) {
+    printf("%zu samples, header %zu bytes once per file\n", SAMPLES, (size_t)(SAMPLE_LOG_FIXED_HEADER + SENSOR_CHANNEL_COUNT * SAMPLE_LOG_CHANNEL_SIZE));
+    benchJson();
+    benchBinary();
+
+    std::vector<SensorSample> synthetic;
+    for (size_t i = 0; i < SAMPLES; ++i)
+        synthetic.push_back(makeSample(i));
+    bool ok = benchBlocks("v2 blocks", synthetic, 45);
+
+    const char* path = argc > 1 ? argv[1] : "tools/mapped_sensors.csv";
+    std::vector<SensorSample> recorded = loadCsv(path);
+    if (recorded.empty()) {
+        printf("%s: no samples, recorded dataset skipped\n", path);
+        return ok ? 0 : 1;
+    }
+    printf("%s: %zu samples\n", path, recorded.size());
+    ok = benchBlocks("v2 blocks 45", recorded, 45) && ok;
+    ok = benchBlocks("v2 blocks 64", recorded, 64) && ok;
+    for (uint8_t deadband : {8, 24, 64})
+        ok = benchDeadband(recorded, deadband, 900) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,67 @@
+// Sampler / writer pipeline on std::thread: a writer that stalls like a slow SD card must not delay sampling.
+// g++ -O2 -std=gnu++17 -pthread host/bench/pipeline_bench.cpp -o pipeline_bench
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "../../src/pipeline/sample_pipeline.h"
+
+struct BenchState {
+    std::chrono::steady_clock::time_point last;
+    long maxGapUs = 0;
+    uint32_t nextTimestamp = 0;
+    uint32_t expectTimestamp = 0;
+    uint32_t outOfOrder = 0;
+    unsigned long stallEvery = 0;
+    unsigned long stallMs = 0;
+    unsigned long batches = 0;
+};
+
+static bool sample(BenchState* st, SensorSample& out) {
+    auto now = std::chrono::steady_clock::now();
+    if (st->nextTimestamp > 0) {
+        long gap = (long)std::chrono::duration_cast<std::chrono::microseconds>(now - st->last).count();
+        if (gap > st->maxGapUs) st->maxGapUs = gap;
+    }
+    st->last = now;
+    out.timestamp = st->nextTimestamp++;
+    forEachChannel([&](auto i) { out.values[i] = (uint16_t)(1800 - 300 * i); });
+    return true;
+}
+
+static void write(BenchState* st, const SensorSample* batch, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (batch[i].timestamp < st->expectTimestamp) st->outOfOrder++;
+        st->expectTimestamp = batch[i].timestamp + 1;
+    }
+    if (st->stallEvery && ++st->batches % st->stallEvery == 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(st->stallMs));
+}
+
+static void run(const char* label, unsigned long stallEvery, unsigned long stallMs) {
+    BenchState st;
+    st.stallEvery = stallEvery;
+    st.stallMs = stallMs;
+
+    PipelineConfig cfg;
+    cfg.samplePeriodMs = 1;
+    cfg.writerIdleMs = 5;
+
+    SamplePipeline pipeline;
+    pipeline.start([&st](SensorSample& s) { return sample(&st, s); },
+                   [&st](const SensorSample* b, size_t n) { write(&st, b, n); }, cfg);
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    pipeline.stop();
+
+    PipelineStats s = pipeline.stats();
+    printf("%-22s produced %6u written %6u dropped %5u batches %5u maxDepth %4zu/%zu maxGap %6ld us order errors %u\n",
+           label, s.produced, s.written, s.dropped, s.batches, s.maxDepth, s.capacity, st.maxGapUs, st.outOfOrder);
+}
+
+int main() {
+    run("no stalls", 0, 0);
+    run("100ms stall / 10", 10, 100);
+    run("500ms stall / 20", 20, 500);
+    return 0;
+}
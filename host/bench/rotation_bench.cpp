@@ -0,0 +1,91 @@
+// Sustained samples per second through log file selection + a 10 byte record write, on the host SD stand-in:
+// the old per sample probe of every /logs/*_N.bin against LogRotation's cached hour and index.
+// Small files so _1, _2 ... rollover files pile up within the hour like a long day on a 20 MB limit.
+// Needs ArduinoJson (SDCardService does), built next to smc_host.
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+
+#include <ArduinoJson.h>
+
+#include "../../src/scheduler/scheduler.h"
+#include "../../src/service/ServiceRegistry.h"
+#include "../../src/service/sdcard/SDCardService.h"
+#include "../../src/service/sensorlog/LogRotation.h"
+
+static const size_t MAX_SIZE = 8 * 1024;
+static const size_t SAMPLES = 20000;
+static const time_t START = 1752451200;
+
+// SensorLoggingService::getLogFilePath() before the cache, kept verbatim for comparison
+static String probePath(SDCardService& sd, time_t now) {
+    struct tm* tmInfo = localtime(&now);
+    char timeStr[32];
+    strftime(timeStr, sizeof(timeStr), "/logs/%Y%m%d_%H", tmInfo);
+    int index = 0;
+    String base = String(timeStr);
+    while (true) {
+        String path = base;
+        if (index > 0)
+            path += "_" + String(index);
+        path += SAMPLE_LOG_EXT;
+        if (!sd.fileExists(path) || sd.openFile(path, FILE_READ).size() < MAX_SIZE)
+            return path;
+        index++;
+    }
+}
+
+template<typename Select>
+static void run(const char* label, SDCardService& sd, Select select) {
+    std::error_code ec;
+    std::filesystem::remove_all(std::string(getenv("SMC_SD_ROOT")) + "/logs", ec);
+    sd.createDir("/logs");
+
+    File file;
+    String path;
+    size_t fileSize = 0;
+    uint8_t record[SAMPLE_LOG_RECORD_SIZE] = {};
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        time_t now = START + (time_t)(i * 4 / 3);
+        String next;
+        if (select(now, fileSize, next) && next != path) {
+            file.close();
+            file = sd.openFile(next, FILE_APPEND);
+            path = next;
+            fileSize = file.size();
+        }
+        file.write(record, sizeof(record));
+        fileSize += sizeof(record);
+    }
+    file.close();
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("%-22s %9.0f samples/s  (%zu samples, %.2f s)\n", label, SAMPLES / sec, SAMPLES, sec);
+}
+
+int main() {
+    setenv("SMC_SD_ROOT", "rotation-bench-sd", 0);
+    ServiceRegistry registry;
+    Scheduler scheduler;
+    SDCardService sd(registry, scheduler);
+    sd.start();
+    if (!sd.ready())
+        return 1;
+
+    run("probe every sample", sd, [&sd](time_t now, size_t, String& next) {
+        next = probePath(sd, now);
+        return true;
+    });
+
+    LogRotation rotation(MAX_SIZE);
+    bool first = true;
+    run("cached rotation", sd, [&](time_t now, size_t fileSize, String& next) {
+        if (!first && !rotation.due(now, fileSize))
+            return false;
+        first = false;
+        next = rotation.next(sd, now);
+        return true;
+    });
+    return 0;
+}
@@ -0,0 +1,26 @@
+// Bare assertions for the host checks: every failed CHECK is printed with its line and counts, checkResult()
+// is the exit status ctest looks at. No framework to install next to the Arduino toolchain.
+#ifndef HOST_CHECK_H
+#define HOST_CHECK_H
+
+#include <cstdio>
+
+static int checkFailures = 0;
+
+#define CHECK(condition)                                                                   \
+    do {                                                                                   \
+        if (!(condition)) {                                                                \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            checkFailures++;                                                               \
+        }                                                                                  \
+    } while (0)
+
+static int checkResult(const char* name) {
+    if (checkFailures)
+        fprintf(stderr, "%s: %d checks failed\n", name, checkFailures);
+    else
+        printf("%s: ok\n", name);
+    return checkFailures ? 1 : 0;
+}
+
+#endif
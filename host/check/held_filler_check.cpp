@@ -0,0 +1,181 @@
+// HeldSampleFiller (src/pipeline/deadband.h) at the edges of the hold: a gap of exactly heartbeat plus one sample
+// period is filled, one second more is no data, sample periods that are not whole seconds land on the right
+// seconds, and nothing is held across a session start. Also the session flag through the block codec and reader.
+
+#include <cstring>
+#include <vector>
+
+#include "check.h"
+#include "../../src/pipeline/deadband.h"
+#include "../../src/pipeline/sample_codec.h"
+#include "../../src/pipeline/sample_log_reader.h"
+
+static SampleLogHeader headerOf(uint32_t periodMs, uint8_t deadband, uint16_t heartbeatS) {
+    SampleLogHeader header;
+    header.version = SAMPLE_LOG_VERSION_BLOCKS;
+    header.samplePeriodMs = periodMs;
+    header.addChannel("ADC4", 4, deadband, heartbeatS);
+    return header;
+}
+
+struct Filled {
+    std::vector<uint32_t> timestamps;
+    std::vector<uint16_t> values;
+};
+
+static void add(HeldSampleFiller& filler, Filled& out, uint32_t timestamp, uint16_t value) {
+    filler.add(timestamp, &value, [&](uint32_t t, const uint16_t* v) {
+        out.timestamps.push_back(t);
+        out.values.push_back(v[0]);
+    });
+}
+
+static std::vector<uint32_t> secondsFrom(uint32_t first, uint32_t last) {
+    std::vector<uint32_t> seconds;
+    for (uint32_t t = first; t <= last; ++t)
+        seconds.push_back(t);
+    return seconds;
+}
+
+static void checkHoldBoundary() {
+    // heartbeat 10 s, 1 s period: a record holds for 11 s
+    HeldSampleFiller filler;
+    filler.begin(headerOf(1000, 5, 10));
+    Filled out;
+    add(filler, out, 100, 7);
+    add(filler, out, 111, 9);
+    CHECK(out.timestamps == secondsFrom(100, 111));
+    CHECK(out.values.size() == 12 && out.values[10] == 7 && out.values[11] == 9);
+
+    // one second past the hold: sampling stopped somewhere in between
+    out = Filled();
+    add(filler, out, 123, 9);
+    CHECK(out.timestamps == std::vector<uint32_t>{123});
+
+    // neighbouring samples and a clock step backwards fill nothing
+    out = Filled();
+    add(filler, out, 124, 9);
+    add(filler, out, 120, 9);
+    CHECK(out.timestamps == (std::vector<uint32_t>{124, 120}));
+}
+
+static void checkPeriods() {
+    // the default 1332 ms period: samples land on the seconds the sampler would have stamped
+    HeldSampleFiller filler;
+    filler.begin(headerOf(1332, 5, 10));
+    Filled out;
+    add(filler, out, 100, 1);
+    add(filler, out, 104, 2);
+    CHECK(out.timestamps == (std::vector<uint32_t>{100, 101, 102, 104}));
+    // hold is 10 + 2 s; 12 s is filled up to the sample before the record, 13 s is not filled
+    out = Filled();
+    add(filler, out, 116, 3);
+    CHECK(out.timestamps.size() == 9 && out.timestamps.front() == 105 && out.timestamps.back() == 116);
+    out = Filled();
+    add(filler, out, 129, 3);
+    CHECK(out.timestamps == std::vector<uint32_t>{129});
+
+    // half second periods share timestamps, each second is held once
+    filler.begin(headerOf(500, 5, 10));
+    out = Filled();
+    add(filler, out, 100, 1);
+    add(filler, out, 103, 2);
+    CHECK(out.timestamps == secondsFrom(100, 103));
+
+    // a log that is not deadbanded passes through
+    filler.begin(headerOf(1000, 0, 10));
+    out = Filled();
+    add(filler, out, 100, 1);
+    add(filler, out, 105, 2);
+    CHECK(out.timestamps == (std::vector<uint32_t>{100, 105}));
+}
+
+static void checkSessionStart() {
+    HeldSampleFiller filler;
+    filler.begin(headerOf(1000, 5, 10));
+    Filled out;
+    add(filler, out, 100, 7);
+    filler.startSession();
+    add(filler, out, 105, 9);
+    add(filler, out, 108, 9);
+    CHECK(out.timestamps == (std::vector<uint32_t>{100, 105, 106, 107, 108}));
+}
+
+// what SampleLogReader needs of a file, over a byte vector
+class MemoryFile {
+public:
+    explicit MemoryFile(const std::vector<uint8_t>& data) : data(data) {}
+    bool seek(uint32_t to) {
+        position = to;
+        return to <= data.size();
+    }
+    size_t read(uint8_t* buffer, size_t length) {
+        size_t n = position < data.size() ? std::min(length, data.size() - position) : 0;
+        memcpy(buffer, data.data() + position, n);
+        position += n;
+        return n;
+    }
+    size_t size() {
+        return data.size();
+    }
+
+private:
+    const std::vector<uint8_t>& data;
+    size_t position = 0;
+};
+
+static void checkSessionFlag() {
+    SampleLogHeader header = headerOf(1000, 5, 10);
+    std::vector<uint8_t> log(SAMPLE_LOG_MAX_HEADER);
+    log.resize(SampleLogEncoder::encodeHeader(header, log.data(), log.size()));
+
+    SampleBlockEncoder encoder;
+    encoder.begin(header.channelCount, 4);
+    uint8_t block[SAMPLE_BLOCK_MAX_SIZE];
+    const uint16_t value = 7;
+    size_t firstBlock = log.size();
+    for (uint32_t t : {100, 101})
+        encoder.add(t, &value);
+    size_t length = encoder.finish(block);
+    log.insert(log.end(), block, block + length);
+    // an empty finish() keeps the flag for the block that has samples
+    encoder.startSession();
+    CHECK(encoder.finish(block) == 0);
+    size_t secondBlock = log.size();
+    for (uint32_t t : {105, 106, 107})
+        encoder.add(t, &value);
+    length = encoder.finish(block);
+    log.insert(log.end(), block, block + length);
+
+    CHECK(!SampleBlockDecoder::sessionStart(log.data() + firstBlock));
+    CHECK(SampleBlockDecoder::sessionStart(log.data() + secondBlock));
+    uint32_t timestamps[SAMPLE_BLOCK_MAX_SAMPLES];
+    uint16_t values[SAMPLE_BLOCK_MAX_SAMPLES];
+    CHECK(SampleBlockDecoder::decode(header, log.data() + secondBlock, length, timestamps, values) == 3);
+    CHECK(timestamps[0] == 105 && timestamps[2] == 107);
+
+    MemoryFile file(log);
+    SampleLogReader<MemoryFile> reader;
+    CHECK(reader.open(&file, nullptr));
+    std::vector<uint32_t> starts;
+    reader.range(0, UINT32_MAX, [&](uint32_t t, const uint16_t*) {
+        if (reader.sessionStart())
+            starts.push_back(t);
+    });
+    CHECK(starts == std::vector<uint32_t>{105});
+    // a range starting inside the marked block does not begin with its session start
+    starts.clear();
+    reader.range(106, UINT32_MAX, [&](uint32_t t, const uint16_t*) {
+        if (reader.sessionStart())
+            starts.push_back(t);
+    });
+    CHECK(starts.empty());
+}
+
+int main() {
+    checkHoldBoundary();
+    checkPeriods();
+    checkSessionStart();
+    checkSessionFlag();
+    return checkResult("held_filler_check");
+}
@@ -0,0 +1,97 @@
+// Header value parsing of src/service/webserver/HttpConditional.h: the Range forms a client following a log sends,
+// IMF-fixdate both ways, If-None-Match lists with weak tags, and which Accept-Encoding values get the gzip pages.
+
+#include <cstring>
+
+#include "check.h"
+#include "../../src/service/webserver/HttpConditional.h"
+
+using namespace http_conditional;
+
+static void checkRange() {
+    size_t first = 0, last = 0;
+
+    // suffix: the last n bytes, all of them when n is longer than the file
+    CHECK(parseRange("bytes=-100", 1000, first, last) == RangeResult::Partial && first == 900 && last == 999);
+    CHECK(parseRange("bytes=-2000", 1000, first, last) == RangeResult::Partial && first == 0 && last == 999);
+    CHECK(parseRange("bytes=-0", 1000, first, last) == RangeResult::Unsatisfiable);
+    CHECK(parseRange("bytes=-5", 0, first, last) == RangeResult::Unsatisfiable);
+
+    // open: from first to the end, what a client that has the first bytes of a log asks for
+    CHECK(parseRange("bytes=500-", 1000, first, last) == RangeResult::Partial && first == 500 && last == 999);
+    CHECK(parseRange("bytes=999-", 1000, first, last) == RangeResult::Partial && first == 999 && last == 999);
+    CHECK(parseRange("bytes=1000-", 1000, first, last) == RangeResult::Unsatisfiable);
+
+    // closed, the end clamped to the file
+    CHECK(parseRange("bytes=0-9", 1000, first, last) == RangeResult::Partial && first == 0 && last == 9);
+    CHECK(parseRange("bytes=10-5000", 1000, first, last) == RangeResult::Partial && first == 10 && last == 999);
+    CHECK(parseRange("bytes=2000-3000", 1000, first, last) == RangeResult::Unsatisfiable);
+
+    // anything else is answered with the whole file
+    CHECK(parseRange("bytes=5-2", 1000, first, last) == RangeResult::Whole);
+    CHECK(parseRange("bytes=0-1,5-6", 1000, first, last) == RangeResult::Whole);
+    CHECK(parseRange("items=0-1", 1000, first, last) == RangeResult::Whole);
+    CHECK(parseRange("bytes=", 1000, first, last) == RangeResult::Whole);
+    CHECK(parseRange("bytes=-", 1000, first, last) == RangeResult::Whole);
+    CHECK(parseRange("bytes=abc", 1000, first, last) == RangeResult::Whole);
+    CHECK(parseRange("bytes=1-2x", 1000, first, last) == RangeResult::Whole);
+    CHECK(parseRange("bytes=-5x", 1000, first, last) == RangeResult::Whole);
+}
+
+static void checkDate() {
+    // the example of RFC 9110 section 5.6.7
+    CHECK(parseHttpDate("Sun, 06 Nov 1994 08:49:37 GMT") == 784111777);
+    CHECK(parseHttpDate("Thu, 01 Jan 1970 00:00:00 GMT") == 0);
+    CHECK(parseHttpDate("Thu, 29 Feb 2024 23:59:59 GMT") == 1709251199);
+
+    const time_t times[] = {1752451200, 1709251199, 951782400, 4102444799};
+    for (time_t t : times) {
+        char date[32];
+        httpDate(t, date, sizeof(date));
+        CHECK(strlen(date) == 29);
+        CHECK(parseHttpDate(date) == t);
+    }
+
+    // the obsolete RFC 850 and asctime forms are not parsed, nor is a month that is not one
+    CHECK(parseHttpDate("Sunday, 06-Nov-94 08:49:37 GMT") == 0);
+    CHECK(parseHttpDate("Sun Nov  6 08:49:37 1994") == 0);
+    CHECK(parseHttpDate("Sun, 06 anF 1994 08:49:37 GMT") == 0);
+    CHECK(parseHttpDate("Sun, 06 Foo 1994 08:49:37 GMT") == 0);
+    CHECK(parseHttpDate("") == 0);
+}
+
+static void checkNoneMatch() {
+    const char* tag = "\"3e8-687455c0\"";
+    CHECK(noneMatchHits("\"3e8-687455c0\"", tag));
+    CHECK(noneMatchHits("W/\"3e8-687455c0\"", tag));
+    CHECK(noneMatchHits("\"1-1\", W/\"3e8-687455c0\"", tag));
+    CHECK(noneMatchHits("W/\"1-1\" ,W/\"3e8-687455c0\" ", tag));
+    CHECK(noneMatchHits("*", tag));
+    CHECK(!noneMatchHits("\"1-1\", W/\"2-2\"", tag));
+    CHECK(!noneMatchHits("\"3e8-687455c\"", tag));
+    CHECK(!noneMatchHits("\"3e8-687455c0\"x", tag));
+    CHECK(!noneMatchHits("", tag));
+}
+
+static void checkAcceptEncoding() {
+    CHECK(acceptsGzip("gzip"));
+    CHECK(acceptsGzip("gzip, deflate, br"));
+    CHECK(acceptsGzip("br;q=1.0, GZIP;q=0.5"));
+    CHECK(acceptsGzip("x-gzip"));
+    CHECK(acceptsGzip("*"));
+    CHECK(acceptsGzip("identity;q=0.5, *;q=0.1"));
+    CHECK(!acceptsGzip("identity"));
+    CHECK(!acceptsGzip(""));
+    CHECK(!acceptsGzip("gzip;q=0"));
+    CHECK(!acceptsGzip("gzip;q=0.000, *"));
+    CHECK(!acceptsGzip("*;q=0"));
+    CHECK(!acceptsGzip("gzipx, deflate"));
+}
+
+int main() {
+    checkRange();
+    checkDate();
+    checkNoneMatch();
+    checkAcceptEncoding();
+    return checkResult("http_conditional_check");
+}
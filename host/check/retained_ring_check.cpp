@@ -0,0 +1,109 @@
+// Replay of src/pipeline/retained_ring.h after a reboot: only intact slots of the last lap, newer than the committed
+// timestamp and older than the first new sample, oldest first. Torn and stale slots are what a reset in the middle
+// of push() and RTC memory after power on leave behind.
+
+#include <cstring>
+#include <vector>
+
+#include "check.h"
+#include "../../src/pipeline/retained_ring.h"
+
+static RetainedRingStore store;
+
+static SensorSample sampleAt(uint32_t timestamp) {
+    SensorSample sample;
+    sample.timestamp = timestamp;
+    for (size_t c = 0; c < SENSOR_CHANNEL_COUNT; ++c)
+        sample.values[c] = (uint16_t)(timestamp * 3 + c);
+    return sample;
+}
+
+static std::vector<uint32_t> replayed(const RetainedSampleRing& ring, uint32_t before) {
+    std::vector<uint32_t> timestamps;
+    size_t n = ring.replay(before, [&](const SensorSample& sample) {
+        CHECK(memcmp(sample.values, sampleAt(sample.timestamp).values, sizeof(sample.values)) == 0);
+        timestamps.push_back(sample.timestamp);
+    });
+    CHECK(n == timestamps.size());
+    return timestamps;
+}
+
+static void checkRecover() {
+    memset(&store, 0xA5, sizeof(store));  // what RTC_NOINIT holds after power on
+    RetainedSampleRing ring(store);
+    CHECK(!ring.recover());
+    CHECK(replayed(ring, UINT32_MAX).empty());
+
+    ring.push(sampleAt(1000));
+    RetainedSampleRing rebooted(store);
+    CHECK(rebooted.recover());
+    CHECK(replayed(rebooted, UINT32_MAX) == std::vector<uint32_t>{1000});
+
+    // another slot layout does not trust the slots
+    store.slotSize++;
+    CHECK(!rebooted.recover());
+    CHECK(replayed(rebooted, UINT32_MAX).empty());
+}
+
+static void checkWindow() {
+    RetainedSampleRing ring(store);
+    memset(&store, 0, sizeof(store));
+    ring.recover();
+    for (uint32_t t = 100; t < 110; ++t)
+        ring.push(sampleAt(t));
+
+    // after the committed timestamp, before the first sample of the new batch
+    ring.commit(103);
+    CHECK(replayed(ring, 108) == (std::vector<uint32_t>{104, 105, 106, 107}));
+    CHECK(replayed(ring, 104).empty());
+    ring.commit(109);
+    CHECK(replayed(ring, UINT32_MAX).empty());
+    ring.commit(0);
+    CHECK(replayed(ring, 101) == std::vector<uint32_t>{100});
+}
+
+static void checkTornSlots() {
+    RetainedSampleRing ring(store);
+    memset(&store, 0, sizeof(store));
+    ring.recover();
+    for (uint32_t t = 200; t < 206; ++t)
+        ring.push(sampleAt(t));
+
+    // reset between the value copy and the check of push(): the slot no longer matches its check
+    store.slot[2].values[0] ^= 0x10;
+    // reset before head moved on: the next slot is written but not yet part of the ring
+    RetainedRingSlot& next = store.slot[6];
+    next.seq = 6;
+    next.timestamp = 206;
+    // a slot left from an earlier lap carries an old sequence number
+    store.slot[4].seq += RETAINED_RING_SLOTS;
+    CHECK(replayed(ring, UINT32_MAX) == (std::vector<uint32_t>{200, 201, 203, 205}));
+}
+
+static void checkWrap() {
+    RetainedSampleRing ring(store);
+    memset(&store, 0, sizeof(store));
+    ring.recover();
+    const uint32_t pushed = RETAINED_RING_SLOTS * 2 + 5;
+    for (uint32_t t = 1; t <= pushed; ++t)
+        ring.push(sampleAt(t));
+
+    // only the last lap is left, replayed oldest first from the slot after head
+    std::vector<uint32_t> timestamps = replayed(ring, UINT32_MAX);
+    CHECK(timestamps.size() == RETAINED_RING_SLOTS);
+    CHECK(!timestamps.empty() && timestamps.front() == pushed - RETAINED_RING_SLOTS + 1 && timestamps.back() == pushed);
+    for (size_t i = 1; i < timestamps.size(); ++i)
+        CHECK(timestamps[i] == timestamps[i - 1] + 1);
+
+    // a clock stepped backwards: samples at or before the committed timestamp are taken as logged
+    ring.commit(pushed - 3);
+    CHECK(replayed(ring, UINT32_MAX) == (std::vector<uint32_t>{pushed - 2, pushed - 1, pushed}));
+}
+
+int main() {
+    checkRecover();
+    checkWindow();
+    checkTornSlots();
+    checkWrap();
+    return checkResult("retained_ring_check");
+}
@@ -0,0 +1,11 @@
+// Runs the firmware's startApp()/updateApp() loop as a Linux process against the stand-ins in host/stub.
+// The SD card is ./sdcard (SMC_SD_ROOT), EEPROM is ./eeprom.bin (SMC_EEPROM_FILE), HTTP listens on SMC_HTTP_PORT.
+
+#include "../src/main.h"
+
+int main() {
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    startApp();
+    while (true)
+        updateApp();
+}
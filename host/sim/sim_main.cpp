@@ -0,0 +1,78 @@
+// Runs startApp()/updateApp() on a VirtualClock: every scheduler sleep becomes a jump to the next deadline,
+// so days of log rotation and cookie expiry play out in seconds.
+// smc_sim [days]   SD card in ./sim-sdcard (SMC_SD_ROOT), EEPROM in ./sim-eeprom.bin (SMC_EEPROM_FILE)
+
+#include <chrono>
+#include <filesystem>
+
+#include "../../src/main.h"
+
+static const time_t SIM_START = 1752451200;  // 2025-07-14 00:00:00 UTC, the start of tools/mapped_sensors.csv
+
+int main(int argc, char** argv) {
+    double days = argc > 1 ? atof(argv[1]) : 7.0;
+    setenv("SMC_SD_ROOT", "sim-sdcard", 0);
+    setenv("SMC_EEPROM_FILE", "sim-eeprom.bin", 0);
+
+    VirtualClock clock(SIM_START);
+    scheduler.setClock(clock);
+
+    auto wallStart = std::chrono::steady_clock::now();
+    startApp();
+
+    const uint64_t endMs = (uint64_t)(days * 86400000.0);
+    unsigned long updates = 0;
+    bool cookieSet = false;
+    time_t cookieSetAt = 0, cookieGoneAt = 0;
+    while (clock.elapsed() < endMs) {
+        updateApp();
+        updates++;
+
+        // one cookie that expires after a day and is deleted after two
+        if (!cookieSet && service_webcookie.ready()) {
+            service_webcookie.setCookie("sim", "admin", 86400, 2 * 86400);
+            cookieSetAt = clock.unixTime();
+            cookieSet = true;
+        }
+        if (cookieSet && !cookieGoneAt && !service_webcookie.has("sim"))
+            cookieGoneAt = clock.unixTime();
+    }
+    service_sensorlog.shutdown();
+    double wallSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    unsigned long dispatches = 0;
+    scheduler.forEachTask([&dispatches](const char*, unsigned long, bool, bool, const TaskStats& stats) {
+        dispatches += stats.runs;
+    });
+
+    size_t logFiles = 0, rollupFiles = 0;
+    uintmax_t logBytes = 0, rollupBytes = 0;
+    std::error_code ec;
+    for (auto& entry : std::filesystem::directory_iterator(std::string(getenv("SMC_SD_ROOT")) + "/logs", ec)) {
+        if (!entry.is_regular_file())
+            continue;
+        logFiles++;
+        logBytes += entry.file_size(ec);
+    }
+    for (auto& entry : std::filesystem::directory_iterator(std::string(getenv("SMC_SD_ROOT")) + ROLLUP_DIR, ec)) {
+        rollupFiles++;
+        rollupBytes += entry.file_size(ec);
+    }
+
+    PipelineStats pipeline = service_sensorlog.pipelineStats();
+    GroupCommitStats commit = service_sensorlog.writerStats();
+    printf("\nsimulated %.2f days in %.2f s wall (%.0fx)\n", clock.elapsed() / 86400000.0, wallSec,
+           clock.elapsed() / 1000.0 / wallSec);
+    printf("updateApp() calls   %lu\n", updates);
+    printf("task dispatches     %lu (%.0f/s wall)\n", dispatches, dispatches / wallSec);
+    printf("samples written     %u (%.0f/s wall)\n", pipeline.written, pipeline.written / wallSec);
+    printf("log files           %zu, %ju bytes\n", logFiles, logBytes);
+    printf("rollup files        %zu, %ju bytes\n", rollupFiles, rollupBytes);
+    printf("commits             %u (%u per simulated hour), %u sector spills\n", commit.commits, commit.commitsPerHour,
+           commit.sectorWrites);
+    if (cookieGoneAt)
+        printf("cookie deleted      %.2f h after it was set\n", (cookieGoneAt - cookieSetAt) / 3600.0);
+    else
+        printf("cookie deleted      no\n");
+    return 0;
+}
@@ -0,0 +1,206 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+// Host stand-in for the Arduino core: timing, String, Serial, analogRead and ESP, enough to build the firmware as a Linux process.
+
+#include <chrono>
+#include <thread>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+#include "esp_system.h"
+
+#define PROGMEM
+
+inline unsigned long millis() {
+    static const auto start = std::chrono::steady_clock::now();
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+inline unsigned long micros() {
+    static const auto start = std::chrono::steady_clock::now();
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+inline void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+inline bool isPrintable(int c) {
+    return c >= 0x20 && c < 0x7F;
+}
+
+///@brief Arduino String on top of std::string, only the members the firmware uses
+class String {
+public:
+    String() {}
+    String(const char* s) : str(s ? s : "") {}
+    String(const std::string& s) : str(s) {}
+    String(char c) : str(1, c) {}
+    String(int v) : str(std::to_string(v)) {}
+    String(unsigned int v) : str(std::to_string(v)) {}
+    String(long v) : str(std::to_string(v)) {}
+    String(unsigned long v) : str(std::to_string(v)) {}
+    String(long long v) : str(std::to_string(v)) {}
+    String(unsigned long long v) : str(std::to_string(v)) {}
+
+    const char* c_str() const { return str.c_str(); }
+    unsigned int length() const { return (unsigned int)str.size(); }
+    bool isEmpty() const { return str.empty(); }
+    void reserve(unsigned int size) { str.reserve(size); }
+    char operator[](unsigned int i) const { return i < str.size() ? str[i] : 0; }
+    char charAt(unsigned int i) const { return (*this)[i]; }
+
+    String& operator+=(const String& o) { str += o.str; return *this; }
+    String& operator+=(const char* o) { str += o ? o : ""; return *this; }
+    String& operator+=(char c) { str += c; return *this; }
+    bool concat(const String& o) { str += o.str; return true; }
+    bool concat(const char* s) { str += s ? s : ""; return true; }
+    bool concat(const char* s, unsigned int n) { str.append(s, n); return true; }
+    bool concat(char c) { str += c; return true; }
+
+    friend String operator+(const String& a, const String& b) { return String(a.str + b.str); }
+    friend String operator+(const String& a, const char* b) { return String(a.str + (b ? b : "")); }
+    friend String operator+(const char* a, const String& b) { return String((a ? a : "") + b.str); }
+    friend String operator+(const String& a, char b) { return String(a.str + b); }
+
+    bool operator==(const String& o) const { return str == o.str; }
+    bool operator==(const char* o) const { return str == (o ? o : ""); }
+    bool operator!=(const String& o) const { return str != o.str; }
+    bool operator!=(const char* o) const { return !(*this == o); }
+    bool operator<(const String& o) const { return str < o.str; }
+
+    bool startsWith(const String& p) const { return str.compare(0, p.str.size(), p.str) == 0; }
+    bool endsWith(const String& s) const {
+        return s.str.size() <= str.size() && str.compare(str.size() - s.str.size(), s.str.size(), s.str) == 0;
+    }
+    int indexOf(const String& s, unsigned int from = 0) const { return toIndex(str.find(s.str, from)); }
+    int indexOf(char c, unsigned int from = 0) const { return toIndex(str.find(c, from)); }
+    int lastIndexOf(char c) const { return toIndex(str.rfind(c)); }
+    String substring(unsigned int from) const { return from < str.size() ? String(str.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) std::swap(from, to);
+        return from < str.size() ? String(str.substr(from, to - from)) : String();
+    }
+    long toInt() const { return strtol(str.c_str(), nullptr, 10); }
+    void toCharArray(char* buf, unsigned int size) const {
+        if (!size) return;
+        size_t n = str.size() < size - 1 ? str.size() : size - 1;
+        memcpy(buf, str.data(), n);
+        buf[n] = 0;
+    }
+    void trim() {
+        size_t b = str.find_first_not_of(" \t\r\n");
+        size_t e = str.find_last_not_of(" \t\r\n");
+        str = b == std::string::npos ? std::string() : str.substr(b, e - b + 1);
+    }
+
+    // ArduinoJson writer/reader hooks
+    size_t write(uint8_t c) { str += (char)c; return 1; }
+    size_t write(const uint8_t* data, size_t n) { str.append((const char*)data, n); return n; }
+
+    const std::string& std() const { return str; }
+
+private:
+    std::string str;
+
+    static int toIndex(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+};
+
+///@brief base of Serial and File: the print()/println()/printf() family over a virtual write()
+class Print {
+public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* data, size_t n) {
+        size_t written = 0;
+        while (n--) written += write(*data++);
+        return written;
+    }
+
+    size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+    size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return print(String(v)); }
+    size_t print(unsigned int v) { return print(String(v)); }
+    size_t print(long v) { return print(String(v)); }
+    size_t print(unsigned long v) { return print(String(v)); }
+    size_t print(long long v) { return print(String(v)); }
+    size_t print(unsigned long long v) { return print(String(v)); }
+
+    template<typename T>
+    size_t println(const T& v) { return print(v) + print("\n"); }
+    size_t println() { return print("\n"); }
+
+    template<typename... Args>
+    size_t printf(const char* fmt, Args... args) {
+        char buf[512];
+        int n = snprintf(buf, sizeof(buf), fmt, args...);
+        if (n < 0) return 0;
+        return write((const uint8_t*)buf, (size_t)n < sizeof(buf) ? n : sizeof(buf) - 1);
+    }
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual size_t readBytes(char* buf, size_t n) {
+        size_t count = 0;
+        int c;
+        while (count < n && (c = read()) >= 0)
+            buf[count++] = (char)c;
+        return count;
+    }
+};
+
+struct HostSerial : public Print {
+    void begin(unsigned long) {}
+    using Print::write;
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    size_t write(const uint8_t* data, size_t n) override { return fwrite(data, 1, n, stdout); }
+};
+
+static HostSerial Serial;
+
+class IPAddress {
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : octets{a, b, c, d} {}
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+        return String(buf);
+    }
+    operator String() const { return toString(); }
+
+private:
+    uint8_t octets[4];
+};
+
+// synthetic probes: a per pin level with a slow drift and a little noise, in ADC counts
+inline uint16_t analogRead(uint8_t pin) {
+    double t = millis() / 1000.0;
+    double level = 900.0 + 300.0 * (pin % 4) + 40.0 * sin(t / 600.0 + pin);
+    return (uint16_t)(level + (rand() % 17) - 8);
+}
+
+struct HostESP {
+    void restart() {
+        hostRunShutdownHandlers();
+        Serial.println("ESP.restart() on host, exiting.");
+        fflush(stdout);
+        exit(0);
+    }
+    uint32_t getFreeHeap() const { return 0; }
+};
+
+static HostESP ESP;
+
+#endif
@@ -0,0 +1,5 @@
+#ifndef HOST_ASYNCTCP_H
+#define HOST_ASYNCTCP_H
+// Host stand-in: the socket handling lives in ESPAsyncWebServer.h.
+
+#endif
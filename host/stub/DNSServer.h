@@ -0,0 +1,15 @@
+#ifndef HOST_DNSSERVER_H
+#define HOST_DNSSERVER_H
+// Host stand-in for the captive portal DNS server, the host resolver is left alone.
+
+#include <Arduino.h>
+
+class DNSServer {
+public:
+    bool start(uint16_t port, const String& domain, const IPAddress& ip) { return true; }
+    void stop() {}
+    void setTTL(uint32_t) {}
+    void processNextRequest() {}
+};
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+// Host stand-in for the emulated EEPROM, persisted to the file named by SMC_EEPROM_FILE (default ./eeprom.bin).
+
+#include <Arduino.h>
+
+#include <vector>
+
+class EEPROMClass {
+public:
+    bool begin(size_t size) {
+        const char* env = getenv("SMC_EEPROM_FILE");
+        path = env && *env ? env : "eeprom.bin";
+        data.assign(size, 0);
+        FILE* fp = fopen(path.c_str(), "rb");
+        if (fp) {
+            size_t n = fread(data.data(), 1, size, fp);
+            (void)n;
+            fclose(fp);
+        }
+        return true;
+    }
+
+    template<typename T>
+    T& get(int address, T& out) {
+        if (address >= 0 && address + sizeof(T) <= data.size())
+            memcpy((void*)&out, data.data() + address, sizeof(T));
+        return out;
+    }
+
+    template<typename T>
+    const T& put(int address, const T& value) {
+        if (address >= 0 && address + sizeof(T) <= data.size())
+            memcpy(data.data() + address, (const void*)&value, sizeof(T));
+        return value;
+    }
+
+    bool commit() {
+        FILE* fp = fopen(path.c_str(), "wb");
+        if (!fp) return false;
+        bool ok = fwrite(data.data(), 1, data.size(), fp) == data.size();
+        fclose(fp);
+        return ok;
+    }
+
+    size_t length() const { return data.size(); }
+
+private:
+    std::string path;
+    std::vector<uint8_t> data;
+};
+
+static EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,503 @@
+#ifndef HOST_ESPASYNCWEBSERVER_H
+#define HOST_ESPASYNCWEBSERVER_H
+// Host stand-in for ESPAsyncWebServer: a blocking HTTP/1.1 server on its own thread, one request per connection.
+// Handlers run on that thread like they run on the async_tcp task on the device. Listens on SMC_HTTP_PORT
+// (default: the constructor port, 8080 if that one cannot be bound). A chunked response whose callback returns
+// RESPONSE_TRY_AGAIN keeps its connection on a thread of its own; the callback runs under the same lock as the
+// handlers, so they still see one task.
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include <functional>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+typedef enum {
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_DELETE = 0b00000100,
+    HTTP_PUT = 0b00001000,
+    HTTP_PATCH = 0b00010000,
+    HTTP_HEAD = 0b00100000,
+    HTTP_OPTIONS = 0b01000000,
+    HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+
+class AsyncWebServerRequest;
+
+// what async_tcp is to the device: handlers and response callbacks never run at the same time
+inline std::mutex& asyncTcpLock() {
+    static std::mutex lock;
+    return lock;
+}
+
+class AsyncWebParameter {
+public:
+    AsyncWebParameter(const String& name, const String& value) : paramName(name), paramValue(value) {}
+    const String& name() const { return paramName; }
+    const String& value() const { return paramValue; }
+
+private:
+    String paramName;
+    String paramValue;
+};
+
+class AsyncWebServerResponse {
+public:
+    AsyncWebServerResponse(int code, const String& contentType, const String& content)
+        : code(code), contentType(contentType), content(content) {}
+    virtual ~AsyncWebServerResponse() = default;
+
+    void addHeader(const String& name, const String& value) { headers.emplace_back(name, value); }
+    void setCode(int c) { code = c; }
+    void setContentType(const String& type) { contentType = type; }
+
+    // full response bytes, the host server sends them in one go
+    std::string serialize() {
+        std::string body = bodyBytes();
+        std::string out = "HTTP/1.1 " + std::to_string(code) + " " + reason(code) + "\r\n";
+        if (contentType.length())
+            out += "Content-Type: " + contentType.std() + "\r\n";
+        if (!streaming())
+            out += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+        for (auto& h : headers)
+            out += h.first.std() + ": " + h.second.std() + "\r\n";
+        out += "Connection: close\r\n\r\n";
+        return out + body;
+    }
+
+protected:
+    int code;
+    String contentType;
+    String content;
+    std::vector<std::pair<String, String>> headers;
+
+    virtual std::string bodyBytes() { return content.std(); }
+
+public:
+    // still open after bodyBytes(): stream() sends the rest, the body ends when the connection closes
+    virtual bool streaming() const { return false; }
+    virtual void stream(int) {}
+
+protected:
+
+    static const char* reason(int code) {
+        switch (code) {
+            case 200: return "OK";
+            case 204: return "No Content";
+            case 206: return "Partial Content";
+            case 302: return "Found";
+            case 304: return "Not Modified";
+            case 400: return "Bad Request";
+            case 403: return "Forbidden";
+            case 404: return "Not Found";
+            case 416: return "Range Not Satisfiable";
+            case 500: return "Internal Server Error";
+            case 503: return "Service Unavailable";
+            default: return "";
+        }
+    }
+};
+
+// bytes that stay where they are, flash on the device
+class AsyncBytesResponse : public AsyncWebServerResponse {
+public:
+    AsyncBytesResponse(int code, const String& contentType, const uint8_t* content, size_t length)
+        : AsyncWebServerResponse(code, contentType, ""), bytes(content), length(length) {}
+
+protected:
+    const uint8_t* bytes;
+    size_t length;
+
+    std::string bodyBytes() override { return std::string((const char*)bytes, length); }
+};
+
+class AsyncFileResponse : public AsyncWebServerResponse {
+public:
+    AsyncFileResponse(File file, const String& path, const String& contentType, bool download)
+        : AsyncWebServerResponse(200, contentType, ""), file(file) {
+        if (download) {
+            String name = path.substring(path.lastIndexOf('/') + 1);
+            addHeader("Content-Disposition", "attachment; filename=\"" + name + "\"");
+        }
+    }
+
+protected:
+    File file;
+
+    std::string bodyBytes() override {
+        std::string body;
+        uint8_t buf[1024];
+        size_t n;
+        while ((n = file.read(buf, sizeof(buf))) > 0)
+            body.append((const char*)buf, n);
+        file.close();
+        return body;
+    }
+};
+
+typedef std::function<size_t(uint8_t*, size_t, size_t)> AwsResponseFiller;
+
+#define RESPONSE_TRY_AGAIN 0xFFFFFFFF
+
+// the callback fills buffers until it returns 0; the device sends each as an HTTP chunk, the host collects them.
+// RESPONSE_TRY_AGAIN: nothing yet, the device asks again on the next ack or poll, the host every 100 ms
+class AsyncChunkedResponse : public AsyncWebServerResponse {
+public:
+    AsyncChunkedResponse(const String& contentType, AwsResponseFiller filler)
+        : AsyncWebServerResponse(200, contentType, ""), filler(filler) {}
+
+    bool streaming() const override { return open; }
+
+    // on its own thread, without the lock but while calling back
+    void stream(int fd) override {
+        uint8_t buf[1460];
+        while (true) {
+            size_t n;
+            {
+                std::lock_guard<std::mutex> guard(asyncTcpLock());
+                n = filler(buf, sizeof(buf), produced);
+            }
+            if (n == 0)
+                return;
+            if (n == RESPONSE_TRY_AGAIN) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                continue;
+            }
+            produced += n;
+            for (size_t off = 0; off < n;) {
+                ssize_t sent = ::send(fd, buf + off, n - off, MSG_NOSIGNAL);
+                if (sent <= 0)
+                    return;  // the client went away
+                off += sent;
+            }
+        }
+    }
+
+protected:
+    AwsResponseFiller filler;
+    size_t produced = 0;
+    bool open = false;
+
+    std::string bodyBytes() override {
+        std::string body;
+        uint8_t buf[1460];
+        size_t n;
+        while ((n = filler(buf, sizeof(buf), body.size())) > 0) {
+            if (n == RESPONSE_TRY_AGAIN) {
+                open = true;
+                break;
+            }
+            body.append((const char*)buf, n);
+        }
+        produced = body.size();
+        return body;
+    }
+};
+
+// a body of known length from a callback, asked for no more than what is left of it
+class AsyncCallbackResponse : public AsyncWebServerResponse {
+public:
+    AsyncCallbackResponse(const String& contentType, size_t length, AwsResponseFiller filler)
+        : AsyncWebServerResponse(200, contentType, ""), length(length), filler(filler) {}
+
+protected:
+    size_t length;
+    AwsResponseFiller filler;
+
+    std::string bodyBytes() override {
+        std::string body;
+        uint8_t buf[1460];
+        while (body.size() < length) {
+            size_t n = filler(buf, std::min(sizeof(buf), length - body.size()), body.size());
+            if (n == 0 || n == RESPONSE_TRY_AGAIN)
+                break;
+            body.append((const char*)buf, n);
+        }
+        return body;
+    }
+};
+
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, const String&, size_t, uint8_t*, size_t, bool)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, uint8_t*, size_t, size_t, size_t)> ArBodyHandlerFunction;
+
+class AsyncWebServerRequest {
+public:
+    void* _tempObject = nullptr;
+
+    const String& url() const { return path; }
+    WebRequestMethod method() const { return requestMethod; }
+    size_t contentLength() const { return body.size(); }
+
+    bool hasHeader(const String& name) const { return findHeader(name) != nullptr; }
+    String header(const String& name) const {
+        const String* value = findHeader(name);
+        return value ? *value : String();
+    }
+
+    bool hasParam(const String& name, bool post = false) const { return getParam(name, post) != nullptr; }
+    const AsyncWebParameter* getParam(const String& name, bool post = false) const {
+        for (auto& p : params)
+            if (p.name() == name) return &p;
+        return nullptr;
+    }
+
+    AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(), const String& content = String()) {
+        return track(new AsyncWebServerResponse(code, contentType, content));
+    }
+    AsyncWebServerResponse* beginResponse(File file, const String& path, const String& contentType = String(), bool download = false) {
+        return track(new AsyncFileResponse(file, path, contentType, download));
+    }
+
+    AsyncWebServerResponse* beginResponse(int code, const String& contentType, const uint8_t* content, size_t len) {
+        return track(new AsyncBytesResponse(code, contentType, content, len));
+    }
+    AsyncWebServerResponse* beginResponse(const String& contentType, size_t len, AwsResponseFiller callback) {
+        return track(new AsyncCallbackResponse(contentType, len, callback));
+    }
+
+    AsyncWebServerResponse* beginChunkedResponse(const String& contentType, AwsResponseFiller callback) {
+        return track(new AsyncChunkedResponse(contentType, callback));
+    }
+
+    void send(AsyncWebServerResponse* response) {
+        if (!sent && response) {
+            out = response->serialize();
+            sent = true;
+            if (response->streaming())
+                streamed = response;
+        }
+    }
+    void send(int code, const String& contentType = String(), const String& content = String()) {
+        send(beginResponse(code, contentType, content));
+    }
+    void redirect(const String& url) {
+        AsyncWebServerResponse* res = beginResponse(302);
+        res->addHeader("Location", url);
+        send(res);
+    }
+
+private:
+    friend class AsyncWebServer;
+
+    WebRequestMethod requestMethod = HTTP_GET;
+    String path;
+    std::vector<std::pair<String, String>> headers;
+    std::vector<AsyncWebParameter> params;
+    std::string body;
+    std::vector<std::unique_ptr<AsyncWebServerResponse>> responses;
+    std::string out;
+    bool sent = false;
+    AsyncWebServerResponse* streamed = nullptr;
+
+    AsyncWebServerResponse* track(AsyncWebServerResponse* r) {
+        responses.emplace_back(r);
+        return r;
+    }
+
+    const String* findHeader(const String& name) const {
+        for (auto& h : headers)
+            if (strcasecmp(h.first.c_str(), name.c_str()) == 0) return &h.second;
+        return nullptr;
+    }
+};
+
+class AsyncWebServer {
+public:
+    AsyncWebServer(uint16_t port) : port(port) {}
+    ~AsyncWebServer() {
+        if (listenFd >= 0) ::close(listenFd);
+        if (worker.joinable()) worker.detach();
+    }
+
+    void on(const char* uri, ArRequestHandlerFunction onRequest) { on(uri, HTTP_ANY, onRequest); }
+    void on(const char* uri, WebRequestMethod method, ArRequestHandlerFunction onRequest,
+            ArUploadHandlerFunction onUpload = nullptr, ArBodyHandlerFunction onBody = nullptr) {
+        handlers.push_back(Handler{String(uri), method, onRequest, onBody});
+    }
+    void onNotFound(ArRequestHandlerFunction fn) { notFound = fn; }
+
+    void begin() {
+        const char* env = getenv("SMC_HTTP_PORT");
+        uint16_t want = env && *env ? (uint16_t)atoi(env) : port;
+        if (!bindTo(want) && !(env && *env) && !bindTo(8080)) {
+            Serial.println("AsyncWebServer(host): could not bind a port.");
+            return;
+        }
+        Serial.printf("AsyncWebServer(host): listening on http://127.0.0.1:%u/\n", (unsigned)boundPort);
+        worker = std::thread([this]() { serve(); });
+    }
+
+private:
+    struct Handler {
+        String uri;
+        WebRequestMethod method;
+        ArRequestHandlerFunction onRequest;
+        ArBodyHandlerFunction onBody;
+    };
+
+    uint16_t port;
+    uint16_t boundPort = 0;
+    int listenFd = -1;
+    std::thread worker;
+    std::vector<Handler> handlers;
+    ArRequestHandlerFunction notFound;
+
+    bool bindTo(uint16_t p) {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) return false;
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(p);
+        if (bind(fd, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 8) != 0) {
+            ::close(fd);
+            return false;
+        }
+        listenFd = fd;
+        boundPort = p;
+        return true;
+    }
+
+    static bool matches(const Handler& h, const AsyncWebServerRequest& req) {
+        if (!(h.method & req.method())) return false;
+        if (h.uri.endsWith("*"))
+            return req.url().startsWith(h.uri.substring(0, h.uri.length() - 1));
+        return req.url() == h.uri || req.url().startsWith(h.uri + "/");
+    }
+
+    static String urlDecode(const std::string& s) {
+        std::string out;
+        for (size_t i = 0; i < s.size(); ++i) {
+            if (s[i] == '+') out += ' ';
+            else if (s[i] == '%' && i + 2 < s.size()) {
+                out += (char)strtol(s.substr(i + 1, 2).c_str(), nullptr, 16);
+                i += 2;
+            } else out += s[i];
+        }
+        return String(out);
+    }
+
+    void serve() {
+        while (true) {
+            int fd = accept(listenFd, nullptr, nullptr);
+            if (fd < 0) return;
+            if (!handle(fd))
+                ::close(fd);
+        }
+    }
+
+    // true if a streaming response took the connection over
+    bool handle(int fd) {
+        std::string raw;
+        char buf[4096];
+        size_t headerEnd;
+        while ((headerEnd = raw.find("\r\n\r\n")) == std::string::npos) {
+            ssize_t n = recv(fd, buf, sizeof(buf), 0);
+            if (n <= 0) return false;
+            raw.append(buf, n);
+        }
+
+        AsyncWebServerRequest req;
+        size_t lineEnd = raw.find("\r\n");
+        std::string line = raw.substr(0, lineEnd);
+        size_t sp1 = line.find(' '), sp2 = line.rfind(' ');
+        std::string method = line.substr(0, sp1);
+        std::string target = line.substr(sp1 + 1, sp2 - sp1 - 1);
+        req.requestMethod = method == "POST" ? HTTP_POST : method == "PUT" ? HTTP_PUT : method == "DELETE" ? HTTP_DELETE
+                          : method == "PATCH" ? HTTP_PATCH : method == "HEAD" ? HTTP_HEAD : method == "OPTIONS" ? HTTP_OPTIONS : HTTP_GET;
+
+        size_t q = target.find('?');
+        req.path = urlDecode(target.substr(0, q));
+        if (q != std::string::npos) {
+            std::string query = target.substr(q + 1);
+            size_t start = 0;
+            while (start <= query.size()) {
+                size_t amp = query.find('&', start);
+                std::string kv = query.substr(start, amp == std::string::npos ? std::string::npos : amp - start);
+                size_t eq = kv.find('=');
+                if (!kv.empty())
+                    req.params.emplace_back(urlDecode(kv.substr(0, eq)), eq == std::string::npos ? String() : urlDecode(kv.substr(eq + 1)));
+                if (amp == std::string::npos) break;
+                start = amp + 1;
+            }
+        }
+
+        size_t pos = lineEnd + 2;
+        while (pos < headerEnd) {
+            size_t end = raw.find("\r\n", pos);
+            std::string h = raw.substr(pos, end - pos);
+            size_t colon = h.find(':');
+            if (colon != std::string::npos) {
+                size_t v = h.find_first_not_of(' ', colon + 1);
+                req.headers.emplace_back(String(h.substr(0, colon)), String(v == std::string::npos ? "" : h.substr(v)));
+            }
+            pos = end + 2;
+        }
+
+        size_t length = (size_t)req.header("Content-Length").toInt();
+        req.body = raw.substr(headerEnd + 4);
+        while (req.body.size() < length) {
+            ssize_t n = recv(fd, buf, sizeof(buf), 0);
+            if (n <= 0) break;
+            req.body.append(buf, n);
+        }
+
+        const Handler* handler = nullptr;
+        for (auto& h : handlers)
+            if (matches(h, req)) {
+                handler = &h;
+                break;
+            }
+
+        {
+            std::lock_guard<std::mutex> guard(asyncTcpLock());
+            if (handler) {
+                if (handler->onBody && !req.body.empty())
+                    handler->onBody(&req, (uint8_t*)&req.body[0], req.body.size(), 0, req.body.size());
+                if (handler->onRequest)
+                    handler->onRequest(&req);
+            } else if (notFound) {
+                notFound(&req);
+            }
+            if (!req.sent)
+                req.send(500, "text/plain", "No response");
+        }
+
+        size_t off = 0;
+        while (off < req.out.size()) {
+            ssize_t n = ::send(fd, req.out.data() + off, req.out.size() - off, MSG_NOSIGNAL);
+            if (n <= 0) break;
+            off += n;
+        }
+        if (!req.streamed || off < req.out.size())
+            return false;
+
+        std::shared_ptr<AsyncWebServerResponse> response;
+        for (auto& r : req.responses)
+            if (r.get() == req.streamed)
+                response.reset(r.release());
+        std::thread([fd, response]() mutable {
+            response->stream(fd);
+            // the callback's captures go with the response, under the lock like on the device
+            std::lock_guard<std::mutex> guard(asyncTcpLock());
+            response.reset();
+            ::close(fd);
+        }).detach();
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,179 @@
+#ifndef HOST_FS_H
+#define HOST_FS_H
+// Host stand-in for fs::File / fs::FS, backed by a directory on the local filesystem.
+
+#include <Arduino.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File : public Stream {
+public:
+    File() {}
+
+    static File open(const std::string& hostPath, const std::string& path, const char* mode) {
+        File f;
+        std::error_code ec;
+        bool isDir = std::filesystem::is_directory(hostPath, ec);
+        if (isDir) {
+            f.impl = std::make_shared<Impl>();
+            f.impl->dir = true;
+            for (auto& entry : std::filesystem::directory_iterator(hostPath, ec))
+                f.impl->entries.push_back(entry.path().filename().string());
+        } else {
+            const char* fmode = strcmp(mode, "w") == 0 ? "w+b" : strcmp(mode, "a") == 0 ? "a+b" : "rb";
+            FILE* fp = fopen(hostPath.c_str(), fmode);
+            if (!fp) return f;
+            f.impl = std::make_shared<Impl>();
+            f.impl->fp = fp;
+        }
+        f.impl->hostPath = hostPath;
+        f.impl->path = path;
+        return f;
+    }
+
+    explicit operator bool() const { return impl && (impl->dir || impl->fp); }
+
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t n) override {
+        if (!impl || !impl->fp) return 0;
+        return fwrite(data, 1, n, impl->fp);
+    }
+
+    int read() override {
+        if (!impl || !impl->fp) return -1;
+        return fgetc(impl->fp);
+    }
+    size_t read(uint8_t* buf, size_t n) {
+        if (!impl || !impl->fp) return 0;
+        return fread(buf, 1, n, impl->fp);
+    }
+    size_t readBytes(char* buf, size_t n) override { return read((uint8_t*)buf, n); }
+    int peek() override {
+        int c = read();
+        if (c >= 0) ungetc(c, impl->fp);
+        return c;
+    }
+    int available() override {
+        if (!impl || !impl->fp) return 0;
+        long remaining = (long)size() - (long)position();
+        return remaining > 0 ? (int)remaining : 0;
+    }
+    bool seek(uint32_t pos, SeekMode mode = SeekSet) {
+        if (!impl || !impl->fp) return false;
+        return fseek(impl->fp, pos, mode == SeekSet ? SEEK_SET : mode == SeekCur ? SEEK_CUR : SEEK_END) == 0;
+    }
+    size_t position() const {
+        if (!impl || !impl->fp) return 0;
+        return (size_t)ftell(impl->fp);
+    }
+    size_t size() const {
+        if (!impl) return 0;
+        if (impl->fp) fflush(impl->fp);
+        struct stat st;
+        return stat(impl->hostPath.c_str(), &st) == 0 ? (size_t)st.st_size : 0;
+    }
+    time_t getLastWrite() const {
+        if (!impl) return 0;
+        struct stat st;
+        return stat(impl->hostPath.c_str(), &st) == 0 ? st.st_mtime : 0;
+    }
+    void flush() {
+        if (impl && impl->fp) fflush(impl->fp);
+    }
+    void close() {
+        if (impl && impl->fp) {
+            fclose(impl->fp);
+            impl->fp = nullptr;
+        }
+        impl.reset();
+    }
+
+    bool isDirectory() const { return impl && impl->dir; }
+    const char* path() const { return impl ? impl->path.c_str() : ""; }
+    const char* name() const {
+        if (!impl) return "";
+        size_t slash = impl->path.find_last_of('/');
+        return impl->path.c_str() + (slash == std::string::npos || impl->path.size() == 1 ? 0 : slash + 1);
+    }
+
+    File openNextFile() {
+        if (!impl || !impl->dir || impl->next >= impl->entries.size()) return File();
+        const std::string& entry = impl->entries[impl->next++];
+        std::string path = impl->path;
+        if (path.empty() || path.back() != '/') path += "/";
+        return open(impl->hostPath + "/" + entry, path + entry, "r");
+    }
+
+private:
+    struct Impl {
+        ~Impl() {
+            if (fp) fclose(fp);
+        }
+        FILE* fp = nullptr;
+        bool dir = false;
+        std::string hostPath;
+        std::string path;
+        std::vector<std::string> entries;
+        size_t next = 0;
+    };
+    std::shared_ptr<Impl> impl;
+};
+
+///@brief all paths are relative to root, which stands in for the mounted card
+class FS {
+public:
+    void setRoot(const std::string& dir) { root = dir; }
+    const std::string& getRoot() const { return root; }
+
+    File open(const String& path, const char* mode = FILE_READ, bool create = false) {
+        return File::open(hostPath(path), path.std(), mode);
+    }
+    bool exists(const String& path) {
+        std::error_code ec;
+        return std::filesystem::exists(hostPath(path), ec);
+    }
+    bool remove(const String& path) {
+        std::error_code ec;
+        return std::filesystem::is_regular_file(hostPath(path), ec) && std::filesystem::remove(hostPath(path), ec);
+    }
+    bool rename(const String& from, const String& to) {
+        std::error_code ec;
+        std::filesystem::rename(hostPath(from), hostPath(to), ec);
+        return !ec;
+    }
+    bool mkdir(const String& path) {
+        std::error_code ec;
+        return std::filesystem::create_directory(hostPath(path), ec);
+    }
+    bool rmdir(const String& path) {
+        std::error_code ec;
+        return std::filesystem::is_directory(hostPath(path), ec) && std::filesystem::remove(hostPath(path), ec);
+    }
+
+protected:
+    std::string root = "sdcard";
+
+    std::string hostPath(const String& path) const {
+        return root + (path.startsWith("/") ? "" : "/") + path.std();
+    }
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef HOST_SD_H
+#define HOST_SD_H
+// Host stand-in for the SD library: the card is the directory named by SMC_SD_ROOT (default ./sdcard).
+
+#include <FS.h>
+#include <SPI.h>
+
+class SDFS : public fs::FS {
+public:
+    bool begin(uint8_t csPin = 0, SPIClass& spi = SPI, uint32_t frequency = 4000000, const char* mountpoint = "/sd",
+               uint8_t maxFiles = 5) {
+        const char* env = getenv("SMC_SD_ROOT");
+        if (env && *env) root = env;
+        std::error_code ec;
+        std::filesystem::create_directories(root, ec);
+        return std::filesystem::is_directory(root, ec);
+    }
+    void end() {}
+    uint64_t cardSize() { return 2ULL * 1024 * 1024 * 1024; }
+};
+
+inline SDFS SD;  // one card for every translation unit, as on the device
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+// Host stand-in for the SPI bus, nothing to drive.
+
+struct SPIClass {
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {}
+    void end() {}
+};
+
+static SPIClass SPI;
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+// Host stand-in for WiFi: the host network is always up, NTP is the host clock.
+
+#include <Arduino.h>
+
+enum wifi_mode_t { WIFI_OFF, WIFI_STA, WIFI_AP, WIFI_AP_STA };
+enum wl_status_t { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_DISCONNECTED = 6 };
+
+class WiFiClass {
+public:
+    bool mode(wifi_mode_t m) { currentMode = m; return true; }
+    wl_status_t begin(const char* ssid, const char* pass = nullptr) { return status(); }
+    wl_status_t status() const { return currentMode == WIFI_STA || currentMode == WIFI_AP_STA ? WL_CONNECTED : WL_DISCONNECTED; }
+    bool disconnect(bool wifioff = false) { return true; }
+    bool setHostname(const char*) { return true; }
+    bool setAutoReconnect(bool) { return true; }
+    IPAddress localIP() const { return IPAddress(127, 0, 0, 1); }
+    bool softAPConfig(IPAddress, IPAddress, IPAddress) { return true; }
+    bool softAP(const char*, const char* pass = nullptr) { return true; }
+    IPAddress softAPIP() const { return IPAddress(127, 0, 0, 1); }
+
+private:
+    wifi_mode_t currentMode = WIFI_OFF;
+};
+
+static WiFiClass WiFi;
+
+inline void configTime(long gmtOffset, int daylightOffset, const char* server1, const char* server2 = nullptr) {}
+
+inline bool getLocalTime(struct tm* info, uint32_t ms = 5000) {
+    time_t now = time(nullptr);
+    return localtime_r(&now, info) != nullptr;
+}
+
+#endif
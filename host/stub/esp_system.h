@@ -0,0 +1,37 @@
+#ifndef HOST_ESP_SYSTEM_H
+#define HOST_ESP_SYSTEM_H
+// Host stand-in for esp_system.h: shutdown handlers, run by ESP.restart() before the process exits.
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_ERR_NO_MEM 0x101
+
+typedef void (*shutdown_handler_t)(void);
+
+#define HOST_SHUTDOWN_HANDLERS 5
+
+inline shutdown_handler_t* hostShutdownHandlers() {
+    static shutdown_handler_t handlers[HOST_SHUTDOWN_HANDLERS] = {};
+    return handlers;
+}
+
+inline esp_err_t esp_register_shutdown_handler(shutdown_handler_t handler) {
+    shutdown_handler_t* handlers = hostShutdownHandlers();
+    for (int i = 0; i < HOST_SHUTDOWN_HANDLERS; ++i) {
+        if (!handlers[i]) {
+            handlers[i] = handler;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+// newest first, like esp_restart()
+inline void hostRunShutdownHandlers() {
+    shutdown_handler_t* handlers = hostShutdownHandlers();
+    for (int i = HOST_SHUTDOWN_HANDLERS - 1; i >= 0; --i)
+        if (handlers[i])
+            handlers[i]();
+}
+
+#endif
@@ -0,0 +1,226 @@
+// Prints binary sensor logs (src/pipeline/sample_log.h) as the JSON lines older firmware wrote, so
+// pd.read_json(..., lines=True) and other line based tools keep working on copied SD cards.
+// Rollup files print one line per bucket with count and <channel>_min / _max / _mean.
+// With --from / --to (unix seconds) raw logs are read through SampleLogReader and their index/ sidecar,
+// like the firmware does, and the bytes that took go to stderr.
+// Change triggered logs print their records; --held fills in the samples each record stood for, one per sample
+// period as an every-sample log would have them, and leaves the gaps that mean no data empty (see deadband.h),
+// as well as the one before a record that starts a logging session.
+// smc_logcat [--csv] [--held] [--from T] [--to T] file.bin...
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "../../src/pipeline/deadband.h"
+#include "../../src/pipeline/sample_codec.h"
+#include "../../src/pipeline/sample_log.h"
+#include "../../src/pipeline/sample_log_reader.h"
+
+// what SampleLogReader needs of a file
+class StdioFile {
+public:
+    explicit StdioFile(const char* path) : f(fopen(path, "rb")) {}
+    ~StdioFile() {
+        if (f)
+            fclose(f);
+    }
+    explicit operator bool() const {
+        return f != nullptr;
+    }
+    bool seek(uint32_t position) {
+        return fseek(f, position, SEEK_SET) == 0;
+    }
+    size_t read(uint8_t* buffer, size_t length) {
+        return fread(buffer, 1, length, f);
+    }
+    size_t size() {
+        long position = ftell(f);
+        fseek(f, 0, SEEK_END);
+        long end = ftell(f);
+        fseek(f, position, SEEK_SET);
+        return (size_t)end;
+    }
+
+private:
+    FILE* f;
+};
+
+static SampleLogReader<StdioFile> reader;
+static HeldSampleFiller filler;
+static bool held = false;
+
+static void printRecord(const SampleLogHeader& header, bool csv, uint32_t timestamp, const uint16_t* values) {
+    printf(csv ? "%u" : "{\"timestamp\":%u", timestamp);
+    for (uint8_t c = 0; c < header.channelCount; ++c) {
+        if (csv)
+            printf(",%u", values[c]);
+        else
+            printf(",\"%s\":%u", header.channels[c].name, values[c]);
+    }
+    printf(csv ? "\n" : "}\n");
+}
+
+// the filler carries on from one file into the next of the same kind, so an hour's tail is filled as well
+static void startFill(const SampleLogHeader& header) {
+    static SampleLogHeader filling;
+    if (filling.channelCount == 0 || !header.sameChannels(filling) || header.samplePeriodMs != filling.samplePeriodMs)
+        filler.begin(header);
+    filling = header;
+}
+
+// a record of a raw log, with the samples it held before it under --held
+static void printSample(const SampleLogHeader& header, bool csv, uint32_t timestamp, const uint16_t* values,
+                        bool sessionStart) {
+    if (!held) {
+        printRecord(header, csv, timestamp, values);
+        return;
+    }
+    if (sessionStart)
+        filler.startSession();
+    filler.add(timestamp, values, [&](uint32_t t, const uint16_t* v) { printRecord(header, csv, t, v); });
+}
+
+static bool readFile(const char* path, std::vector<uint8_t>& data) {
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return false;
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0)
+        data.insert(data.end(), chunk, chunk + n);
+    fclose(f);
+    return true;
+}
+
+static void printCsvHeader(const SampleLogHeader& header) {
+    printf(header.rollup ? "timestamp,count" : "timestamp");
+    for (uint8_t c = 0; c < header.channelCount; ++c) {
+        if (header.rollup)
+            printf(",%s_min,%s_max,%s_mean", header.channels[c].name, header.channels[c].name,
+                   header.channels[c].name);
+        else
+            printf(",%s", header.channels[c].name);
+    }
+    printf("\n");
+}
+
+// the samples of one raw log in [from, to), false if it is not one
+static bool printRange(const char* path, bool csv, bool& csvHeader, uint32_t from, uint32_t to) {
+    char indexPath[512];
+    StdioFile log(path);
+    if (!log || !sample_index::indexPath(path, indexPath, sizeof(indexPath)))
+        return false;
+    StdioFile index(indexPath);
+    if (!reader.open(&log, index ? &index : nullptr) || reader.header().rollup)
+        return false;
+    if (csv && !csvHeader) {
+        printCsvHeader(reader.header());
+        csvHeader = true;
+    }
+    startFill(reader.header());
+    size_t found = reader.range(from, to, [&](uint32_t timestamp, const uint16_t* values) {
+        printSample(reader.header(), csv, timestamp, values, reader.sessionStart());
+    });
+    fprintf(stderr, "%s: %zu samples, %zu of %zu bytes read%s\n", path, found, reader.bytesReadSinceOpen(),
+            log.size(), index ? "" : ", no index");
+    return true;
+}
+
+int main(int argc, char** argv) {
+    bool csv = false, ranged = false;
+    uint32_t from = 0, to = UINT32_MAX;
+    int first = 1;
+    for (; first < argc && strncmp(argv[first], "--", 2) == 0; ++first) {
+        if (strcmp(argv[first], "--csv") == 0) {
+            csv = true;
+        } else if (strcmp(argv[first], "--held") == 0) {
+            held = true;
+        } else if (strcmp(argv[first], "--from") == 0 && first + 1 < argc) {
+            from = (uint32_t)strtoul(argv[++first], nullptr, 10);
+            ranged = true;
+        } else if (strcmp(argv[first], "--to") == 0 && first + 1 < argc) {
+            to = (uint32_t)strtoul(argv[++first], nullptr, 10);
+            ranged = true;
+        } else {
+            break;
+        }
+    }
+    if (first >= argc) {
+        fprintf(stderr, "usage: %s [--csv] [--held] [--from T] [--to T] file.bin...\n", argv[0]);
+        return 2;
+    }
+
+    int status = 0;
+    bool csvHeader = false;
+    for (int arg = first; arg < argc; ++arg) {
+        if (ranged) {
+            if (!printRange(argv[arg], csv, csvHeader, from, to)) {
+                fprintf(stderr, "%s: not a raw sensor log\n", argv[arg]);
+                status = 1;
+            }
+            continue;
+        }
+
+        std::vector<uint8_t> data;
+        SampleLogHeader header;
+        size_t offset;
+        if (!readFile(argv[arg], data)) {
+            fprintf(stderr, "%s: cannot read\n", argv[arg]);
+            status = 1;
+            continue;
+        }
+        if ((offset = SampleLogDecoder::decodeHeader(data.data(), data.size(), header)) == 0) {
+            fprintf(stderr, "%s: not a sensor log or rollup\n", argv[arg]);
+            status = 1;
+            continue;
+        }
+
+        if (csv && !csvHeader) {
+            printCsvHeader(header);
+            csvHeader = true;
+        }
+
+        if (header.blocks()) {
+            startFill(header);
+            uint32_t timestamps[SAMPLE_BLOCK_MAX_SAMPLES];
+            uint16_t values[SAMPLE_BLOCK_MAX_SAMPLES * SAMPLE_LOG_MAX_CHANNELS];
+            size_t length;
+            while ((length = SampleBlockDecoder::blockSize(header, data.data() + offset, data.size() - offset)) > 0) {
+                uint16_t n = SampleBlockDecoder::decode(header, data.data() + offset, length, timestamps, values);
+                bool session = SampleBlockDecoder::sessionStart(data.data() + offset);
+                for (uint16_t i = 0; i < n; ++i)
+                    printSample(header, csv, timestamps[i], values + i * header.channelCount, session && i == 0);
+                offset += length;
+            }
+            continue;
+        }
+
+        size_t records = SampleLogDecoder::recordCount(header, data.size());
+        for (size_t r = 0; r < records && header.rollup; ++r, offset += header.recordSize) {
+            uint32_t bucketStart;
+            uint16_t count, minValues[SAMPLE_LOG_MAX_CHANNELS], maxValues[SAMPLE_LOG_MAX_CHANNELS],
+                meanValues[SAMPLE_LOG_MAX_CHANNELS];
+            SampleLogDecoder::decodeRollup(header, data.data() + offset, bucketStart, count, minValues, maxValues,
+                                           meanValues);
+            printf(csv ? "%u,%u" : "{\"timestamp\":%u,\"count\":%u", bucketStart, count);
+            for (uint8_t c = 0; c < header.channelCount; ++c) {
+                const char* name = header.channels[c].name;
+                if (csv)
+                    printf(",%u,%u,%u", minValues[c], maxValues[c], meanValues[c]);
+                else
+                    printf(",\"%s_min\":%u,\"%s_max\":%u,\"%s_mean\":%u", name, minValues[c], name, maxValues[c],
+                           name, meanValues[c]);
+            }
+            printf(csv ? "\n" : "}\n");
+        }
+        for (size_t r = 0; r < records && !header.rollup; ++r, offset += header.recordSize) {
+            uint32_t timestamp;
+            uint16_t values[SAMPLE_LOG_MAX_CHANNELS];
+            SampleLogDecoder::decodeRecord(header, data.data() + offset, timestamp, values);
+            printSample(header, csv, timestamp, values, false);
+        }
+    }
+    return status;
+}
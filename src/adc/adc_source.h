@@ -0,0 +1,98 @@
+#ifndef ADC_SOURCE_H
+#define ADC_SOURCE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "sensor_channels.h"
+
+#ifndef ADC_MAX_CHANNELS
+#define ADC_MAX_CHANNELS 8
+#endif
+
+struct AdcConfig {
+    uint32_t conversionRateHz = 12000;  // all channels together, one pattern step each: 83 us between channels at 3 pins
+    uint32_t outputPeriodMs = 1332;     // one averaged reading per channel this often
+    uint32_t pollPeriodMs = 200;        // how often the sampler drains the source, bounded by its buffer
+};
+
+///@brief per channel running sum of raw conversions, what a source drains into
+struct AdcAccumulator {
+    uint64_t sum[ADC_MAX_CHANNELS] = {};
+    uint32_t count[ADC_MAX_CHANNELS] = {};
+    uint32_t total = 0;
+
+    void add(uint8_t channel, uint32_t valueSum, uint32_t n) {
+        sum[channel] += valueSum;
+        count[channel] += n;
+        total += n;
+    }
+
+    void clear() {
+        *this = AdcAccumulator();
+    }
+};
+
+///@brief a set of pins converted continuously in a fixed pattern; drain() never blocks
+class AdcSource {
+public:
+    virtual ~AdcSource() = default;
+
+    // channel i of every drain is channels[i]
+    virtual bool begin(const SensorChannel* channels, uint8_t count, const AdcConfig& config) = 0;
+
+    // moves every conversion finished since the last call into acc, returns how many
+    virtual size_t drain(AdcAccumulator& acc) = 0;
+
+    virtual void end() = 0;
+};
+
+///@brief integrate and dump decimation: averages everything converted over one output period. Periods are counted
+/// in conversions, not wall time, so the output rate follows the ADC clock and the remainder carries over.
+class AdcDecimator {
+public:
+    void begin(AdcSource& src, uint8_t channelCount, const AdcConfig& config) {
+        source = &src;
+        channels = channelCount;
+        perOutput = (uint32_t)((uint64_t)config.conversionRateHz * config.outputPeriodMs / 1000);
+        if (perOutput < channels)
+            perOutput = channels;
+        target = perOutput;
+        acc.clear();
+        memset(last, 0, sizeof(last));
+    }
+
+    // drains the source; true with one averaged value per channel in out once an output period is complete.
+    // A channel without conversions in the period repeats its last value.
+    bool poll(uint16_t* out) {
+        source->drain(acc);
+        if (acc.total < target)
+            return false;
+
+        for (uint8_t i = 0; i < channels; ++i) {
+            if (acc.count[i] > 0)
+                last[i] = (uint16_t)((acc.sum[i] + acc.count[i] / 2) / acc.count[i]);
+            out[i] = last[i];
+        }
+        // a poll that overshot shortens the next period by as much, so outputs keep the configured rate on average
+        uint32_t over = acc.total - target;
+        target = over < perOutput ? perOutput - over : 1;
+        acc.clear();
+        return true;
+    }
+
+    uint32_t conversionsPerOutput() const {
+        return perOutput;
+    }
+
+private:
+    AdcSource* source = nullptr;
+    AdcAccumulator acc;
+    uint8_t channels = 0;
+    uint32_t perOutput = 1;
+    uint32_t target = 1;
+    uint16_t last[ADC_MAX_CHANNELS] = {};
+};
+
+#endif
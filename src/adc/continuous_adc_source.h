@@ -0,0 +1,107 @@
+#ifndef CONTINUOUS_ADC_SOURCE_H
+#define CONTINUOUS_ADC_SOURCE_H
+
+#ifdef ESP_PLATFORM
+
+#include <Arduino.h>
+#include <esp_adc/adc_continuous.h>
+
+#include "adc_source.h"
+
+#ifndef ADC_FRAME_BYTES
+#define ADC_FRAME_BYTES (256 * SOC_ADC_DIGI_RESULT_BYTES)
+#endif
+#ifndef ADC_STORE_BYTES
+#define ADC_STORE_BYTES (16 * 1024)  // 340 ms of conversions at 12 kHz, comfortably more than one poll period
+#endif
+
+///@brief ADC1 in continuous mode: the DMA fills ADC_STORE_BYTES in the background, drain() parses whatever is there.
+/// Replaces three blocking analogRead() calls per sample; the CPU only touches the results.
+class ContinuousAdcSource : public AdcSource {
+public:
+    bool begin(const SensorChannel* channels, uint8_t count, const AdcConfig& config) override {
+        if (count == 0 || count > ADC_MAX_CHANNELS || count > SOC_ADC_PATT_LEN_MAX)
+            return false;
+
+        memset(channelIndex, NONE, sizeof(channelIndex));
+        adc_digi_pattern_config_t pattern[ADC_MAX_CHANNELS] = {};
+        for (uint8_t i = 0; i < count; ++i) {
+            adc_unit_t unit;
+            adc_channel_t channel;
+            if (adc_continuous_io_to_channel(channels[i].pin, &unit, &channel) != ESP_OK || unit != ADC_UNIT_1) {
+                Serial.printf("ContinuousAdcSource: pin %u is not on ADC1\n", channels[i].pin);
+                return false;
+            }
+            pattern[i].atten = attenOf(channels[i].atten);
+            pattern[i].channel = channel;
+            pattern[i].unit = ADC_UNIT_1;
+            pattern[i].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+            channelIndex[channel] = i;
+        }
+
+        adc_continuous_handle_cfg_t handleConfig = {};
+        handleConfig.max_store_buf_size = ADC_STORE_BYTES;
+        handleConfig.conv_frame_size = ADC_FRAME_BYTES;
+        if (adc_continuous_new_handle(&handleConfig, &handle) != ESP_OK) {
+            handle = nullptr;
+            return false;
+        }
+
+        adc_continuous_config_t adcConfig = {};
+        adcConfig.pattern_num = count;
+        adcConfig.adc_pattern = pattern;
+        adcConfig.sample_freq_hz = config.conversionRateHz;
+        adcConfig.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+        adcConfig.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+        if (adc_continuous_config(handle, &adcConfig) != ESP_OK || adc_continuous_start(handle) != ESP_OK) {
+            end();
+            return false;
+        }
+        return true;
+    }
+
+    size_t drain(AdcAccumulator& acc) override {
+        if (!handle)
+            return 0;
+        size_t conversions = 0;
+        uint32_t length = 0;
+        while (adc_continuous_read(handle, frame, sizeof(frame), &length, 0) == ESP_OK) {
+            for (uint32_t off = 0; off + SOC_ADC_DIGI_RESULT_BYTES <= length; off += SOC_ADC_DIGI_RESULT_BYTES) {
+                const adc_digi_output_data_t* result = reinterpret_cast<const adc_digi_output_data_t*>(frame + off);
+                uint32_t channel = result->type2.channel;
+                if (channel < sizeof(channelIndex) && channelIndex[channel] != NONE)
+                    acc.add(channelIndex[channel], result->type2.data, 1);
+            }
+            conversions += length / SOC_ADC_DIGI_RESULT_BYTES;
+        }
+        return conversions;
+    }
+
+    void end() override {
+        if (!handle)
+            return;
+        adc_continuous_stop(handle);
+        adc_continuous_deinit(handle);
+        handle = nullptr;
+    }
+
+private:
+    static constexpr uint8_t NONE = 0xFF;
+
+    static uint8_t attenOf(ChannelAtten atten) {
+        switch (atten) {
+            case ChannelAtten::Db0: return ADC_ATTEN_DB_0;
+            case ChannelAtten::Db2_5: return ADC_ATTEN_DB_2_5;
+            case ChannelAtten::Db6: return ADC_ATTEN_DB_6;
+            default: return ADC_ATTEN_DB_12;
+        }
+    }
+
+    adc_continuous_handle_t handle = nullptr;
+    uint8_t channelIndex[SOC_ADC_MAX_CHANNEL_NUM];
+    uint8_t frame[ADC_FRAME_BYTES];
+};
+
+#endif
+
+#endif
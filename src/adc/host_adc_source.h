@@ -0,0 +1,146 @@
+#ifndef HOST_ADC_SOURCE_H
+#define HOST_ADC_SOURCE_H
+
+#ifndef ESP_PLATFORM
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "adc_source.h"
+#include "../scheduler/clock.h"
+
+///@brief host stand-in for ContinuousAdcSource, conversions appear at conversionRateHz of useClock()'s clock.
+/// Synthetic probes by default (slow drift plus noise per pin, like the stub analogRead()); with SMC_ADC_REPLAY
+/// set to a CSV with a column per channel name (tools/mapped_sensors.csv) it plays the recorded rows back, one per
+/// output period.
+class HostAdcSource : public AdcSource {
+public:
+    // the Scheduler's clock, so simulated time produces conversions too
+    void useClock(Clock& c) {
+        clock = &c;
+    }
+
+    bool begin(const SensorChannel* channelList, uint8_t count, const AdcConfig& cfg) override {
+        if (count == 0 || count > ADC_MAX_CHANNELS)
+            return false;
+        channels = count;
+        for (uint8_t i = 0; i < count; ++i) {
+            pins[i] = channelList[i].pin;
+            names[i] = channelList[i].name;
+        }
+        config = cfg;
+        startMs = lastMs = clock->millis();
+        carry = 0;
+
+        const char* replay = getenv("SMC_ADC_REPLAY");
+        rows.clear();
+        if (replay && *replay && !loadReplay(replay))
+            return false;
+        return true;
+    }
+
+    size_t drain(AdcAccumulator& acc) override {
+        unsigned long now = clock->millis();
+        uint64_t due = (uint64_t)config.conversionRateHz * (now - lastMs) + carry;
+        lastMs = now;
+        carry = due % 1000;
+        uint32_t conversions = (uint32_t)(due / 1000);
+        uint32_t perChannel = conversions / channels;
+        carry += (uint64_t)(conversions - perChannel * channels) * 1000;  // partial pattern, finishes next time
+        if (perChannel == 0)
+            return 0;
+
+        for (uint8_t i = 0; i < channels; ++i)
+            acc.add(i, (uint32_t)(level(i, now) * perChannel), perChannel);
+        return perChannel * channels;
+    }
+
+    void end() override {
+        rows.clear();
+    }
+
+private:
+    Clock* clock = &SystemClock::instance();
+    AdcConfig config;
+    uint8_t channels = 0;
+    uint8_t pins[ADC_MAX_CHANNELS] = {};
+    const char* names[ADC_MAX_CHANNELS] = {};
+    unsigned long startMs = 0;
+    unsigned long lastMs = 0;
+    uint64_t carry = 0;
+    std::vector<std::vector<uint16_t>> rows;
+
+    double level(uint8_t channel, unsigned long now) const {
+        if (!rows.empty()) {
+            size_t row = (size_t)((now - startMs) / config.outputPeriodMs) % rows.size();
+            return rows[row][channel];
+        }
+        double t = now / 1000.0;
+        uint8_t pin = pins[channel];
+        return 900.0 + 300.0 * (pin % 4) + 40.0 * sin(t / 600.0 + pin) + ((rand() % 5) - 2);
+    }
+
+    bool loadReplay(const char* path) {
+        FILE* f = fopen(path, "r");
+        if (!f) {
+            fprintf(stderr, "HostAdcSource: cannot open %s\n", path);
+            return false;
+        }
+
+        char line[512];
+        int columns[ADC_MAX_CHANNELS];
+        bool ok = fgets(line, sizeof(line), f) != nullptr;
+        for (uint8_t i = 0; ok && i < channels; ++i) {
+            columns[i] = columnOf(line, names[i]);
+            if (columns[i] < 0) {
+                fprintf(stderr, "HostAdcSource: %s has no %s column\n", path, names[i]);
+                ok = false;
+            }
+        }
+        while (ok && fgets(line, sizeof(line), f)) {
+            std::vector<uint16_t> row(channels);
+            bool complete = true;
+            for (uint8_t i = 0; i < channels; ++i) {
+                const char* field = fieldAt(line, columns[i]);
+                complete = complete && field && *field >= '0' && *field <= '9';
+                if (complete)
+                    row[i] = (uint16_t)atoi(field);
+            }
+            if (complete)
+                rows.push_back(row);
+        }
+        fclose(f);
+        return ok && !rows.empty();
+    }
+
+    static const char* fieldAt(const char* line, int column) {
+        for (int c = 0; c < column; ++c) {
+            line = strchr(line, ',');
+            if (!line)
+                return nullptr;
+            line++;
+        }
+        return line;
+    }
+
+    static int columnOf(const char* header, const char* name) {
+        size_t length = strlen(name);
+        for (int column = 0; header; ++column) {
+            if (strncmp(header, name, length) == 0 && (header[length] == ',' || header[length] == '\n' ||
+                                                        header[length] == '\r' || header[length] == '\0'))
+                return column;
+            header = strchr(header, ',');
+            if (header)
+                header++;
+        }
+        return -1;
+    }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef SENSOR_CHANNELS_H
+#define SENSOR_CHANNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+
+// The probes, in log column order. Everything per channel is generated from this table: the ADC pattern, the
+// sample layout, when a reading is logged, the log and rollup headers, /api/channels and the graph. Adding a probe is one line here
+// (a pin on ADC1, a name of at most 8 characters); old logs keep their own header and stay readable.
+
+enum class ChannelAtten : uint8_t {
+    Db0,    // up to ~0.95 V
+    Db2_5,  // ~1.25 V
+    Db6,    // ~1.75 V
+    Db12,   // ~3.1 V, what analogRead() used
+};
+
+constexpr const char* attenName(ChannelAtten atten) {
+    return atten == ChannelAtten::Db0     ? "0dB"
+           : atten == ChannelAtten::Db2_5 ? "2.5dB"
+           : atten == ChannelAtten::Db6   ? "6dB"
+                                          : "12dB";
+}
+
+///@brief raw counts in dry air and in water, for a moisture percentage; both 0 until the probe is calibrated
+struct ChannelCalibration {
+    uint16_t dryCounts;
+    uint16_t wetCounts;
+
+    constexpr bool calibrated() const {
+        return dryCounts != wetCounts;
+    }
+};
+
+///@brief when readings reach the log. A deadband of 0 logs every sample; otherwise a sample is only logged once
+/// the channel moved more than deadband counts from its last logged value, or heartbeatSeconds after it
+struct ChannelLogging {
+    uint8_t deadband;
+    uint16_t heartbeatSeconds;
+
+    constexpr bool everySample() const {
+        return deadband == 0;
+    }
+};
+
+struct SensorChannel {
+    uint8_t pin;
+    const char* name;
+    ChannelAtten atten;
+    ChannelCalibration calibration;
+    ChannelLogging logging;  // /config.json can override it per channel, see SensorLoggingService
+};
+
+// 24 counts is about 20 mV at 12 dB, above the noise left after decimation; moisture moves over minutes to hours
+static constexpr SensorChannel SENSOR_CHANNELS[] = {
+    {4, "ADC4", ChannelAtten::Db12, {0, 0}, {24, 900}},  // ADC1_CH3 on the S3
+    {5, "ADC5", ChannelAtten::Db12, {0, 0}, {24, 900}},  // ADC1_CH4
+    {6, "ADC6", ChannelAtten::Db12, {0, 0}, {24, 900}},  // ADC1_CH5
+};
+
+static constexpr size_t SENSOR_CHANNEL_COUNT = sizeof(SENSOR_CHANNELS) / sizeof(SENSOR_CHANNELS[0]);
+
+namespace sensor_channels {
+
+constexpr size_t nameLength(const char* name) {
+    return *name ? 1 + nameLength(name + 1) : 0;
+}
+
+constexpr bool namesFit(size_t limit) {
+    for (const SensorChannel& c : SENSOR_CHANNELS)
+        if (nameLength(c.name) == 0 || nameLength(c.name) > limit)
+            return false;
+    return true;
+}
+
+constexpr bool heartbeatsSet() {
+    for (const SensorChannel& c : SENSOR_CHANNELS)
+        if (!c.logging.everySample() && c.logging.heartbeatSeconds == 0)
+            return false;
+    return true;
+}
+
+template <typename Fn, size_t... I>
+constexpr void unroll(Fn&& fn, std::index_sequence<I...>) {
+    (fn(std::integral_constant<size_t, I>{}), ...);
+}
+
+}  // namespace sensor_channels
+
+static_assert(sensor_channels::heartbeatsSet(), "a channel with a deadband needs a heartbeat");
+
+// fn(std::integral_constant<size_t, i>) for every channel, expanded at compile time: the per-sample paths
+// that use it have no loop and no lookups, SENSOR_CHANNELS[i] is a constant in each call
+template <typename Fn>
+constexpr void forEachChannel(Fn&& fn) {
+    sensor_channels::unroll(fn, std::make_index_sequence<SENSOR_CHANNEL_COUNT>{});
+}
+
+#endif
@@ -1,7 +1,5 @@
 #include "main.h"
 
-static const char* TAG = "main";
-
 Scheduler scheduler;
 ServiceRegistry registry;
 
@@ -12,68 +10,37 @@ WebServerService service_webserver(registry, scheduler);
 SDCardService service_sdcard(registry, scheduler);
 SensorLoggingService service_sensorlog(registry, scheduler);
 
-std::vector<IService*> coreServices = {
-    &service_eeprom,
-    &service_wifi,
-    &service_sdcard,
-    &service_webcookie,
-    &service_webserver,
-    &service_sensorlog
-};
-
-size_t currentServiceIndex = 0;
-bool waitingForReady = false;
-
-void startNextService() {
-    if (currentServiceIndex >= coreServices.size()) {
-        //schedule updates, exit setup
-        for (auto service : coreServices) {
-            unsigned long cycle = service->cycleTimeMs();
-            if (cycle > 0) {
-                scheduler.addTask([service]() {
-                    service->update(service->cycleTimeMs());
-                }, cycle, true);
-            }
-        }
-        Serial.println("All services started.");
-        waitingForReady = false;
-        return;
+#ifdef ESP_PLATFORM
+RTC_NOINIT_ATTR
+#endif
+RetainedRingStore retainedSamples;
+
+void scheduleUpdates(IService* service) {
+    unsigned long cycle = service->cycleTimeMs();
+    if (cycle > 0) {
+        scheduler.addTask(service->getTag(), [service]() {
+            service->update(service->cycleTimeMs());
+        }, cycle, true);
     }
-
-    IService* service = coreServices[currentServiceIndex];
-    Serial.print(service->getTag());
-    Serial.println(": Service starting...");
-    service->start();
-    waitingForReady = true;
 }
 
 void startApp() {
     Serial.begin(115200);
     delay(5);
+    scheduler.begin();
 
     Serial.println("Registering services...");
-    registry["EEPROM"] = &service_eeprom;
-    registry["WIFI"] = &service_wifi;
-    registry["WEBCOOKIE"] = &service_webcookie;
-    registry["WEBSERVER"] = &service_webserver;
-    registry["SDCARD"] = &service_sdcard;
-    registry["SENSORLOG"] = &service_sensorlog;
-    currentServiceIndex = 0;
-    waitingForReady = false;
+    registry.addAll(CoreServices(), service_eeprom, service_wifi, service_sdcard,
+                    service_webcookie, service_webserver, service_sensorlog);
 
-    startNextService();
+    if (!registry.beginStartup())
+        return;
+    registry.updateStartup(scheduleUpdates);
 }
 
 void updateApp() {
     scheduler.update();
-    if (waitingForReady) {
-        IService* service = coreServices[currentServiceIndex];
-        if (service->ready()) {
-            Serial.print(service->getTag());
-            Serial.println(": Service ready.");
-            currentServiceIndex++;
-            waitingForReady = false;
-            startNextService();
-        }
-    }
+    bool booting = !registry.updateStartup(scheduleUpdates);
+    // tickless: block until the next task is due; poll ready() every 10ms while services are still starting
+    scheduler.sleepUntilNext(booting ? 10 : SCHEDULER_MAX_IDLE_MS);
 }
@@ -0,0 +1,107 @@
+#ifndef DEADBAND_H
+#define DEADBAND_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "sample_log.h"
+#include "sample_pipeline.h"
+
+// Change triggered logging. When every channel of a log has a deadband (SampleLogHeader::deadbanded()) the writer
+// keeps a sample only if some channel moved past its deadband since the last kept one, or the heartbeat passed.
+// Every file starts with a kept sample. For a reader, two records at most heartbeat plus one sample period apart
+// mean the first one's values held in between ("no change"); a longer gap means sampling stopped somewhere in it
+// ("no data"), when exactly is not known. Rollups still see every sample, their counts show which seconds had data.
+// A restart breaks that: the first record after it is marked (SAMPLE_BLOCK_SESSION_START) and nothing is held across
+// it, and on shutdown the writer logs the last sample it skipped so the values are known to have held until then.
+
+///@brief the writer side: decides per sample whether it goes to the log, O(1) with the last kept sample as state
+class DeadbandFilter {
+public:
+    // the channel settings of the log header, so the file always describes what the filter does
+    void begin(const SampleLogHeader& header) {
+        enabled = header.deadbanded();
+        heartbeat = header.heartbeatSeconds();
+        for (uint8_t i = 0; i < header.channelCount && i < SENSOR_CHANNEL_COUNT; ++i)
+            deadband[i] = header.channels[i].deadband;
+        primed = false;
+    }
+
+    // the next sample is kept whatever it holds, for the first sample of a new file
+    void reset() {
+        primed = false;
+    }
+
+    bool keep(const SensorSample& sample) {
+        if (!enabled)
+            return true;
+        bool changed = !primed || sample.timestamp < last.timestamp || sample.timestamp - last.timestamp >= heartbeat;
+        forEachChannel([&](auto i) {
+            int32_t delta = (int32_t)sample.values[i] - (int32_t)last.values[i];
+            changed |= delta > deadband[i] || -delta > deadband[i];
+        });
+        if (changed) {
+            last = sample;
+            primed = true;
+        }
+        return changed;
+    }
+
+private:
+    bool enabled = false;
+    bool primed = false;
+    uint32_t heartbeat = 0;
+    int32_t deadband[SENSOR_CHANNEL_COUNT] = {};
+    SensorSample last = {};
+};
+
+///@brief the reader side: turns the records of a deadbanded log back into one sample per sample period, for
+/// consumers that expect the every-sample logs. Gaps that mean "no change" are filled with the held values, gaps
+/// that mean "no data" stay empty. Nothing is filled after the last record, whether its values held on is only
+/// known once the next one is written, and nothing is filled up to a session start. Logs that are not deadbanded pass
+/// through unchanged.
+class HeldSampleFiller {
+public:
+    void begin(const SampleLogHeader& header) {
+        channels = header.channelCount;
+        periodMs = header.samplePeriodMs;
+        hold = header.deadbanded() && periodMs > 0 ? header.heartbeatSeconds() + (periodMs + 999) / 1000 : 0;
+        primed = false;
+    }
+
+    // the next record starts a logging session, the previous one's values did not hold up to it
+    void startSession() {
+        primed = false;
+    }
+
+    // fn(timestamp, values) for the held samples between the previous record and this one, then for this record
+    template <typename Fn>
+    void add(uint32_t timestamp, const uint16_t* values, Fn fn) {
+        if (primed && hold > 0 && timestamp > lastTimestamp && timestamp - lastTimestamp <= hold) {
+            // as many samples as fit a period apart, timestamps are whole seconds so allow half a second of jitter
+            uint64_t gapMs = (uint64_t)(timestamp - lastTimestamp) * 1000 + 500;
+            uint32_t emitted = lastTimestamp;
+            for (uint64_t k = 1; (k + 1) * periodMs <= gapMs; ++k) {
+                uint32_t t = lastTimestamp + (uint32_t)(k * periodMs / 1000);
+                if (t != emitted && t != timestamp)  // sample periods under a second share timestamps
+                    fn(t, lastValues);
+                emitted = t;
+            }
+        }
+        fn(timestamp, values);
+        lastTimestamp = timestamp;
+        memcpy(lastValues, values, channels * sizeof(uint16_t));
+        primed = true;
+    }
+
+private:
+    uint8_t channels = 0;
+    uint32_t periodMs = 0;
+    uint32_t hold = 0;
+    bool primed = false;
+    uint32_t lastTimestamp = 0;
+    uint16_t lastValues[SAMPLE_LOG_MAX_CHANNELS] = {};
+};
+
+#endif
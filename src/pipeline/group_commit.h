@@ -0,0 +1,210 @@
+#ifndef GROUP_COMMIT_H
+#define GROUP_COMMIT_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include <esp_timer.h>
+#else
+#include <chrono>
+#endif
+
+#ifndef GROUP_COMMIT_SECTOR
+#define GROUP_COMMIT_SECTOR 512
+#endif
+#ifndef GROUP_COMMIT_BUFFER_SIZE
+#define GROUP_COMMIT_BUFFER_SIZE (8 * GROUP_COMMIT_SECTOR)
+#endif
+
+static_assert(GROUP_COMMIT_BUFFER_SIZE % GROUP_COMMIT_SECTOR == 0, "GROUP_COMMIT_BUFFER_SIZE must be whole sectors");
+
+///@brief when buffered samples reach the card; durabilityMs is the most a power cut can lose
+struct CommitPolicy {
+    uint16_t maxSamples = 45;        // about a minute at the default 1332 ms sample period
+    uint32_t durabilityMs = 60000;   // oldest uncommitted sample never waits longer than this (checked per batch)
+};
+
+struct GroupCommitStats {
+    size_t buffered;
+    size_t capacity;
+    uint32_t commits;
+    uint32_t failedCommits;     // the card took less than it was given, the rest stays buffered for the next try
+    uint32_t sectorWrites;      // full-buffer spills between commits, whole sectors only
+    uint32_t commitLastUs;
+    uint32_t commitMaxUs;
+    uint32_t commitsPerHour;    // over the time since the writer was attached to its first file
+    uint64_t bytesWritten;
+};
+
+///@brief RAM buffer in front of a log file. append() only copies; the file sees a write() when the buffer
+/// fills (cut so the file position lands on a sector boundary) and a write() + flush() per commit.
+/// A short write keeps the bytes the card did not take and the commit reports failure; they go out first on
+/// the next one. Only a buffer that stays full drops data, and the commit after that fails as well.
+/// FileT needs write(const uint8_t*, size_t), flush() and size(). One writer task, stats() from anywhere.
+template<typename FileT>
+class GroupCommitWriter {
+public:
+    void setPolicy(const CommitPolicy& p) {
+        policy = p;
+    }
+
+    const CommitPolicy& getPolicy() const {
+        return policy;
+    }
+
+    // commits what belongs to the previous file, then appends to f from its current end.
+    // False if the previous file's commit failed, what it did not take is dropped
+    bool attach(FileT* f, unsigned long nowMs) {
+        bool ok = detach(nowMs);
+        file = f;
+        filePos = f ? f->size() : 0;
+        if (!startedMs)
+            startedMs = nowMs ? nowMs : 1;
+        return ok;
+    }
+
+    // commits and lets go of the file, false as for attach()
+    bool detach(unsigned long nowMs) {
+        bool ok = commit(nowMs);
+        if (!ok) {
+            buffered = 0;
+            bufferedNow.store(0, std::memory_order_relaxed);
+            pendingSamples = 0;
+            spilled = false;
+            lost = false;
+        }
+        file = nullptr;
+        return ok;
+    }
+
+    // samples counts toward maxSamples, 0 for headers
+    void append(const uint8_t* data, size_t length, uint16_t samples, unsigned long nowMs) {
+        if (!file)
+            return;
+        if (pendingSamples == 0 && samples > 0)
+            oldestMs = nowMs;
+        pendingSamples += samples;
+        while (length > 0) {
+            size_t n = GROUP_COMMIT_BUFFER_SIZE - buffered;
+            if (n > length) n = length;
+            memcpy(buffer + buffered, data, n);
+            buffered += n;
+            data += n;
+            length -= n;
+            bufferedNow.store(buffered, std::memory_order_relaxed);
+            if (buffered == GROUP_COMMIT_BUFFER_SIZE && !spill()) {
+                lost = true;  // the card takes nothing, the rest of this append has no room
+                return;
+            }
+        }
+    }
+
+    // true when the policy wants a commit; ask after each batch. A failed commit keeps its samples pending,
+    // so it is due again on the next one
+    bool due(unsigned long nowMs) const {
+        return pendingSamples >= policy.maxSamples || (pendingSamples > 0 && nowMs - oldestMs >= policy.durabilityMs);
+    }
+
+    // everything buffered to the card: on rotation, shutdown, or when the policy is due. False if the card
+    // took less than that, or an append since the last commit was dropped
+    bool commit(unsigned long nowMs) {
+        if (!file)
+            return buffered == 0 && !lost;
+        if (buffered == 0 && pendingSamples == 0 && !spilled && !lost)
+            return true;
+        uint64_t start = nowUs();
+        bool ok = writeOut(buffered);
+        file->flush();
+        if (!ok || lost) {
+            lost = false;
+            failedCommits.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        uint32_t took = (uint32_t)(nowUs() - start);
+        pendingSamples = 0;
+        spilled = false;
+        commitLastUs.store(took, std::memory_order_relaxed);
+        if (took > commitMaxUs.load(std::memory_order_relaxed))
+            commitMaxUs.store(took, std::memory_order_relaxed);
+        commits.fetch_add(1, std::memory_order_relaxed);
+        lastCommitMs.store(nowMs, std::memory_order_relaxed);
+        return true;
+    }
+
+    // bytes in the file once everything buffered is written, what rotation has to look at
+    size_t fileSize() const {
+        return filePos + buffered;
+    }
+
+    GroupCommitStats stats() const {
+        GroupCommitStats s;
+        s.buffered = bufferedNow.load(std::memory_order_relaxed);
+        s.capacity = GROUP_COMMIT_BUFFER_SIZE;
+        s.commits = commits.load(std::memory_order_relaxed);
+        s.failedCommits = failedCommits.load(std::memory_order_relaxed);
+        s.sectorWrites = sectorWrites.load(std::memory_order_relaxed);
+        s.commitLastUs = commitLastUs.load(std::memory_order_relaxed);
+        s.commitMaxUs = commitMaxUs.load(std::memory_order_relaxed);
+        s.bytesWritten = bytesWritten.load(std::memory_order_relaxed);
+        unsigned long span = lastCommitMs.load(std::memory_order_relaxed) - startedMs;
+        s.commitsPerHour = startedMs && span > 0 ? (uint32_t)((uint64_t)s.commits * 3600000ULL / span) : 0;
+        return s;
+    }
+
+private:
+    alignas(4) uint8_t buffer[GROUP_COMMIT_BUFFER_SIZE];
+    size_t buffered = 0;
+    size_t filePos = 0;
+    FileT* file = nullptr;
+    CommitPolicy policy;
+    uint16_t pendingSamples = 0;
+    unsigned long oldestMs = 0;
+    unsigned long startedMs = 0;
+    bool spilled = false;
+    bool lost = false;  // an append found the buffer full and the card not taking any of it
+
+    std::atomic<size_t> bufferedNow{0};
+    std::atomic<uint32_t> commits{0};
+    std::atomic<uint32_t> failedCommits{0};
+    std::atomic<uint32_t> sectorWrites{0};
+    std::atomic<uint32_t> commitLastUs{0};
+    std::atomic<uint32_t> commitMaxUs{0};
+    std::atomic<uint64_t> bytesWritten{0};
+    std::atomic<unsigned long> lastCommitMs{0};
+
+    // full buffer: write up to the last sector boundary of the file, keep the rest. False if that made no room
+    bool spill() {
+        size_t end = (filePos + buffered) / GROUP_COMMIT_SECTOR * GROUP_COMMIT_SECTOR;
+        writeOut(end > filePos ? end - filePos : buffered);
+        sectorWrites.fetch_add(1, std::memory_order_relaxed);
+        spilled = true;
+        return buffered < GROUP_COMMIT_BUFFER_SIZE;
+    }
+
+    // the first n buffered bytes to the file; whatever it did not take stays at the front of the buffer
+    bool writeOut(size_t n) {
+        if (n == 0)
+            return true;
+        size_t written = file->write(buffer, n);
+        filePos += written;
+        bytesWritten.fetch_add(written, std::memory_order_relaxed);
+        buffered -= written;
+        memmove(buffer, buffer + written, buffered);
+        bufferedNow.store(buffered, std::memory_order_relaxed);
+        return written == n;
+    }
+
+    static uint64_t nowUs() {
+#ifdef ESP_PLATFORM
+        return (uint64_t)esp_timer_get_time();
+#else
+        return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+};
+
+#endif
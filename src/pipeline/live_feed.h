@@ -0,0 +1,133 @@
+#ifndef LIVE_FEED_H
+#define LIVE_FEED_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "sample_pipeline.h"
+
+#define LIVE_FEED_FRAMES 16  // a subscriber this many frames behind is dropped: ~21 s of stalled TCP at 1.33 s
+#define LIVE_FRAME_SIZE (24 + 9 * SENSOR_CHANNEL_COUNT)  // the channel names event, longer than any sample's
+#define LIVE_MAX_SUBSCRIBERS 4
+
+static_assert(LIVE_FEED_FRAMES >= 2 && (LIVE_FEED_FRAMES & (LIVE_FEED_FRAMES - 1)) == 0,
+              "LiveFeed: frame count must be a power of two");
+static_assert(LIVE_FRAME_SIZE <= 255, "LiveFeed: frame lengths are 8 bit");
+
+// Server-Sent Events, one event per sample, values in SENSOR_CHANNELS order:
+//   event: channels\ndata: ADC4,ADC5,ADC6\n\n     once, when a subscriber connects
+//   data: 1752451200,866,1164,1495\n\n             every sample from then on
+
+///@brief the sampler's samples on their way to live subscribers, never through the card. publish() formats each
+/// sample once into a ring of frames that every LiveSubscriber reads from, so n subscribers cost one frame, not
+/// n copies. One producer, any number of readers, no locks: every slot carries the number of the frame in it
+/// and a reader that finds it overwritten has fallen LIVE_FEED_FRAMES behind and is dropped.
+class LiveFeed {
+public:
+    LiveFeed() {
+        for (Slot& slot : slots)
+            slot.frame.store(UINT32_MAX, std::memory_order_relaxed);
+    }
+
+    // sampler task
+    void publish(const SensorSample& sample) {
+        uint32_t n = published.load(std::memory_order_relaxed);
+        Slot& slot = slots[n % LIVE_FEED_FRAMES];
+        slot.frame.store(UINT32_MAX, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        int length = snprintf(slot.text, sizeof(slot.text), "data: %lu", (unsigned long)sample.timestamp);
+        for (size_t c = 0; c < SENSOR_CHANNEL_COUNT; ++c)
+            length += snprintf(slot.text + length, sizeof(slot.text) - length, ",%u", sample.values[c]);
+        length += snprintf(slot.text + length, sizeof(slot.text) - length, "\n\n");
+        slot.length = (uint8_t)length;
+        slot.frame.store(n, std::memory_order_release);
+        published.store(n + 1, std::memory_order_release);
+    }
+
+    uint32_t frames() const {
+        return published.load(std::memory_order_acquire);
+    }
+
+private:
+    friend class LiveSubscriber;
+
+    struct Slot {
+        std::atomic<uint32_t> frame;  // number of the frame in text, UINT32_MAX while it is written
+        uint8_t length;
+        char text[LIVE_FRAME_SIZE];
+    };
+
+    Slot slots[LIVE_FEED_FRAMES];
+    std::atomic<uint32_t> published{0};
+
+    // frame n into out; false if it is not published yet (lagged false) or already overwritten (lagged true)
+    bool copy(uint32_t n, char* out, uint8_t& length, bool& lagged) const {
+        const Slot& slot = slots[n % LIVE_FEED_FRAMES];
+        lagged = false;
+        if (slot.frame.load(std::memory_order_acquire) == n) {
+            length = slot.length;
+            memcpy(out, slot.text, length);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.frame.load(std::memory_order_relaxed) == n)
+                return true;
+        }
+        lagged = (int32_t)(frames() - n) > 0;
+        return false;
+    }
+};
+
+///@brief one client's place in a LiveFeed: its frames start with the first sample published after begin().
+/// read() hands out the bytes of whole frames in order, as much as the connection takes; the frame being sent is
+/// the only copy a subscriber keeps. Used by one response on the async_tcp task
+class LiveSubscriber {
+public:
+    void begin(const LiveFeed& source) {
+        feed = &source;
+        next = source.frames();
+        isLagged = false;
+        length = (uint8_t)snprintf(frame, sizeof(frame), "event: channels\ndata: ");
+        for (size_t c = 0; c < SENSOR_CHANNEL_COUNT; ++c)
+            length += (uint8_t)snprintf(frame + length, sizeof(frame) - length, c ? ",%s" : "%s",
+                                        SENSOR_CHANNELS[c].name);
+        length += (uint8_t)snprintf(frame + length, sizeof(frame) - length, "\n\n");
+        sent = 0;
+    }
+
+    // the next bytes into out; 0 when there is nothing new, or when the feed lapped this subscriber
+    size_t read(uint8_t* out, size_t capacity) {
+        size_t written = 0;
+        while (written < capacity && !isLagged) {
+            if (sent == length) {
+                if (!feed->copy(next, frame, length, isLagged)) {
+                    length = sent = 0;
+                    break;
+                }
+                next++;
+                sent = 0;
+            }
+            size_t n = (size_t)(length - sent) < capacity - written ? (size_t)(length - sent) : capacity - written;
+            memcpy(out + written, frame + sent, n);
+            sent += n;
+            written += n;
+        }
+        return written;
+    }
+
+    // too slow to keep up, the response should end
+    bool lagged() const {
+        return isLagged;
+    }
+
+private:
+    const LiveFeed* feed = nullptr;
+    uint32_t next = 0;
+    bool isLagged = false;
+    char frame[LIVE_FRAME_SIZE];
+    uint8_t length = 0;
+    uint8_t sent = 0;
+};
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef RETAINED_RING_H
+#define RETAINED_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "sample_pipeline.h"
+
+#ifndef RETAINED_RING_SLOTS
+#define RETAINED_RING_SLOTS 256  // 16 bytes each with 3 channels: 4 KB of the S3's 8 KB RTC slow memory, 5.7 min
+#endif
+#define RETAINED_RING_MAGIC 0x52535052u  // "RPSR"
+#define RETAINED_RING_VERSION 1
+
+// On the ESP32 the store lives in RTC_NOINIT memory, which keeps its content over esp_restart(), panics and
+// watchdog resets and is random after power on. Nothing in it is trusted without its check.
+struct RetainedRingSlot {
+    uint32_t seq;
+    uint32_t timestamp;
+    uint16_t values[SENSOR_CHANNEL_COUNT];
+    uint16_t check;
+};
+
+struct RetainedRingStore {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t slots;
+    uint32_t slotSize;  // a firmware with another channel table does not trust the slots
+    volatile uint32_t head;               // sequence number of the next push, slot head % slots
+    volatile uint32_t committedTimestamp;  // newest sample known to be on the card
+    RetainedRingSlot slot[RETAINED_RING_SLOTS];
+};
+
+///@brief the last RETAINED_RING_SLOTS samples in memory that outlives a soft reset, so samples still in the
+/// pipeline, the block encoder or the group commit buffer, and samples taken while no card was ready, reach
+/// the log after the reboot. The sampler push()es every sample, the writer commit()s what is on the card and
+/// replays the rest. Samples newer than the committed timestamp are the ones missing from the log, which
+/// also holds when the pipeline dropped some; a clock stepped backwards can make replay skip samples.
+class RetainedSampleRing {
+public:
+    explicit RetainedSampleRing(RetainedRingStore& s) : store(s) {}
+
+    // at boot: keeps a store left by the previous run, formats one that is not. True if it was kept
+    bool recover() {
+        if (store.magic == RETAINED_RING_MAGIC && store.version == RETAINED_RING_VERSION &&
+            store.slots == RETAINED_RING_SLOTS && store.slotSize == sizeof(RetainedRingSlot))
+            return true;
+        memset(&store, 0, sizeof(store));
+        store.version = RETAINED_RING_VERSION;
+        store.slots = RETAINED_RING_SLOTS;
+        store.slotSize = sizeof(RetainedRingSlot);
+        store.magic = RETAINED_RING_MAGIC;
+        return false;
+    }
+
+    // sampler task; overwrites the oldest slot
+    void push(const SensorSample& sample) {
+        uint32_t seq = store.head;
+        RetainedRingSlot& slot = store.slot[seq % RETAINED_RING_SLOTS];
+        slot.seq = seq;
+        slot.timestamp = sample.timestamp;
+        memcpy(slot.values, sample.values, sizeof(slot.values));
+        slot.check = checkOf(slot);
+        store.head = seq + 1;
+    }
+
+    // writer task: every sample up to timestamp is on the card
+    void commit(uint32_t timestamp) {
+        store.committedTimestamp = timestamp;
+    }
+
+    uint32_t committedTimestamp() const {
+        return store.committedTimestamp;
+    }
+
+    // writer task: fn(sample) for every intact sample newer than the committed timestamp and older than before,
+    // oldest first. Returns how many
+    template <typename Fn>
+    size_t replay(uint32_t before, Fn fn) const {
+        uint32_t head = store.head;
+        uint32_t first = head > RETAINED_RING_SLOTS ? head - RETAINED_RING_SLOTS : 0;
+        uint32_t after = store.committedTimestamp;
+        size_t replayed = 0;
+        for (uint32_t seq = first; seq != head; ++seq) {
+            RetainedRingSlot slot = store.slot[seq % RETAINED_RING_SLOTS];
+            if (slot.seq != seq || slot.check != checkOf(slot) || slot.timestamp <= after || slot.timestamp >= before)
+                continue;
+            SensorSample sample;
+            sample.timestamp = slot.timestamp;
+            memcpy(sample.values, slot.values, sizeof(sample.values));
+            fn(sample);
+            replayed++;
+        }
+        return replayed;
+    }
+
+private:
+    RetainedRingStore& store;
+
+    // Fletcher-16 over everything but the check itself
+    static uint16_t checkOf(const RetainedRingSlot& slot) {
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(&slot);
+        uint16_t a = 0, b = 0;
+        for (size_t i = 0; i < offsetof(RetainedRingSlot, check); ++i) {
+            a = (a + p[i]) % 255;
+            b = (b + a) % 255;
+        }
+        return (uint16_t)(b << 8 | a);
+    }
+};
+
+#endif
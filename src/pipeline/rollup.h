@@ -0,0 +1,94 @@
+#ifndef ROLLUP_H
+#define ROLLUP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sample_log.h"
+#include "sample_pipeline.h"
+
+#define ROLLUP_CHANNELS SENSOR_CHANNEL_COUNT
+#define ROLLUP_RECORD_SIZE (6 + 6 * ROLLUP_CHANNELS)
+
+///@brief min / max / sum / count per channel over one bucket, aligned to multiples of the bucket length in unix time
+struct RollupBucket {
+    uint32_t start = 0;
+    uint16_t count = 0;
+    uint16_t minValue[ROLLUP_CHANNELS];
+    uint16_t maxValue[ROLLUP_CHANNELS];
+    uint32_t sum[ROLLUP_CHANNELS];
+
+    void reset(uint32_t bucketStart) {
+        start = bucketStart;
+        count = 0;
+        for (uint8_t i = 0; i < ROLLUP_CHANNELS; ++i) {
+            minValue[i] = 0xFFFF;
+            maxValue[i] = 0;
+            sum[i] = 0;
+        }
+    }
+
+    void add(const SensorSample& s) {
+        forEachChannel([&](auto i) {
+            if (s.values[i] < minValue[i]) minValue[i] = s.values[i];
+            if (s.values[i] > maxValue[i]) maxValue[i] = s.values[i];
+            sum[i] += s.values[i];
+        });
+        count++;
+    }
+
+    size_t encode(uint8_t* out) const {
+        sample_log::put32(out, start);
+        sample_log::put16(out + 4, count);
+        for (uint8_t i = 0; i < ROLLUP_CHANNELS; ++i) {
+            uint8_t* channel = out + 6 + 6 * i;
+            sample_log::put16(channel, minValue[i]);
+            sample_log::put16(channel + 2, maxValue[i]);
+            sample_log::put16(channel + 4, count ? (uint16_t)((sum[i] + count / 2) / count) : 0);
+        }
+        return ROLLUP_RECORD_SIZE;
+    }
+};
+
+///@brief one resolution of the rollup, O(1) per sample: fold into the open bucket, hand it out when the next one starts
+class RollupTier {
+public:
+    void begin(uint32_t seconds) {
+        bucketSeconds = seconds;
+        current.reset(0);
+    }
+
+    // true when s opened a new bucket; finished then holds the one it closed
+    bool add(const SensorSample& s, RollupBucket& finished) {
+        uint32_t start = s.timestamp - s.timestamp % bucketSeconds;
+        bool closed = false;
+        if (start != current.start) {
+            if (current.count > 0) {
+                finished = current;
+                closed = true;
+            }
+            current.reset(start);
+        }
+        current.add(s);
+        return closed;
+    }
+
+    // the open bucket so far, for shutdown; a reboot may later write the rest of it as a second record
+    bool takePartial(RollupBucket& partial) {
+        if (current.count == 0)
+            return false;
+        partial = current;
+        current.reset(current.start);
+        return true;
+    }
+
+    uint32_t seconds() const {
+        return bucketSeconds;
+    }
+
+private:
+    uint32_t bucketSeconds = 60;
+    RollupBucket current;
+};
+
+#endif
@@ -0,0 +1,238 @@
+#ifndef SAMPLE_CODEC_H
+#define SAMPLE_CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "sample_log.h"
+#include "sample_pipeline.h"
+
+// Sample blocks of a version 2 log. Each block decodes on its own, a reader can start at any block boundary.
+//   u16 sampleCount | u16 payloadBytes | u32 firstTimestamp | channelCount x u16 firstValue
+//   u8 timestampBits | channelCount x u8 valueBits | payload
+// The payload holds samples 1..sampleCount-1, LSB first: the zig-zag delta of delta of the timestamp in
+// timestampBits, then the zig-zag delta of each channel from the previous sample in its valueBits. Widths are the
+// largest the block needs, so a quiet probe costs a few bits per sample and a noisy one only widens its own block.
+// A block never spans a backwards time step or one over SAMPLE_BLOCK_MAX_STEP, which bounds every width to 17 bits.
+// SAMPLE_BLOCK_SESSION_START in sampleCount marks the block whose first sample is the first one logged after the
+// writer started: whatever the last record before it held, sampling stopped in between.
+
+#define SAMPLE_BLOCK_MAX_SAMPLES 64
+#define SAMPLE_BLOCK_SESSION_START 0x8000
+#define SAMPLE_BLOCK_COUNT_MASK 0x7FFF
+#define SAMPLE_BLOCK_MAX_STEP 0xFFFF  // seconds between neighbouring samples of one block
+#define SAMPLE_BLOCK_MAX_BITS 17
+#define SAMPLE_BLOCK_HEADER_SIZE(channels) (9 + 3 * (channels))
+#define SAMPLE_BLOCK_MAX_SIZE                                        \
+    (SAMPLE_BLOCK_HEADER_SIZE(SAMPLE_LOG_MAX_CHANNELS) +             \
+     ((SAMPLE_BLOCK_MAX_SAMPLES - 1) * SAMPLE_BLOCK_MAX_BITS * (1 + SAMPLE_LOG_MAX_CHANNELS) + 7) / 8)
+
+namespace sample_codec {
+
+inline uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+inline int32_t unzigzag(uint32_t v) {
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+inline uint8_t bitWidth(uint32_t v) {
+    uint8_t bits = 0;
+    while (v) {
+        bits++;
+        v >>= 1;
+    }
+    return bits;
+}
+
+}  // namespace sample_codec
+
+///@brief collects samples into the open block, O(1) per sample; finish() packs it. Holds one block of zig-zag
+/// deltas in RAM (SAMPLE_BLOCK_MAX_SAMPLES x (1 + SAMPLE_LOG_MAX_CHANNELS) words), nothing else.
+class SampleBlockEncoder {
+public:
+    void begin(uint8_t channelCount, uint16_t maxSamples) {
+        channels = channelCount;
+        limit = maxSamples == 0 || maxSamples > SAMPLE_BLOCK_MAX_SAMPLES ? SAMPLE_BLOCK_MAX_SAMPLES : maxSamples;
+        count = 0;
+    }
+
+    // false when a sample taken at timestamp has to start the next block: finish() this one first
+    bool fits(uint32_t timestamp) const {
+        return count == 0 ||
+               (count < limit && timestamp >= lastTimestamp && timestamp - lastTimestamp <= SAMPLE_BLOCK_MAX_STEP);
+    }
+
+    void add(uint32_t timestamp, const uint16_t* values) {
+        if (count == 0) {
+            firstTimestamp = timestamp;
+            memcpy(firstValues, values, channels * sizeof(uint16_t));
+            lastDelta = 0;
+            timestampMask = 0;
+            memset(valueMask, 0, sizeof(valueMask));
+        } else {
+            int32_t delta = (int32_t)(timestamp - lastTimestamp);
+            uint32_t* z = deltas[count - 1];
+            z[0] = sample_codec::zigzag(delta - lastDelta);
+            timestampMask |= z[0];
+            lastDelta = delta;
+            for (uint8_t c = 0; c < channels; ++c) {
+                z[1 + c] = sample_codec::zigzag((int32_t)values[c] - (int32_t)lastValues[c]);
+                valueMask[c] |= z[1 + c];
+            }
+        }
+        lastTimestamp = timestamp;
+        memcpy(lastValues, values, channels * sizeof(uint16_t));
+        count++;
+    }
+
+    void add(const SensorSample& sample) {
+        add(sample.timestamp, sample.values);
+    }
+
+    uint16_t samples() const {
+        return count;
+    }
+
+    // the next block finish() packs is marked as the start of a logging session, call it while the block is empty
+    void startSession() {
+        sessionStart = true;
+    }
+
+    // packs the open block into out (SAMPLE_BLOCK_MAX_SIZE bytes suffice) and starts an empty one.
+    // Returns the block length, 0 when there was nothing to pack
+    size_t finish(uint8_t* out) {
+        if (count == 0)
+            return 0;
+        uint8_t timestampBits = sample_codec::bitWidth(timestampMask);
+        uint8_t valueBits[SAMPLE_LOG_MAX_CHANNELS];
+        size_t bitsPerSample = timestampBits;
+        for (uint8_t c = 0; c < channels; ++c) {
+            valueBits[c] = sample_codec::bitWidth(valueMask[c]);
+            bitsPerSample += valueBits[c];
+        }
+        size_t payload = ((count - 1) * bitsPerSample + 7) / 8;
+
+        sample_log::put16(out, sessionStart ? count | SAMPLE_BLOCK_SESSION_START : count);
+        sample_log::put16(out + 2, (uint16_t)payload);
+        sample_log::put32(out + 4, firstTimestamp);
+        uint8_t* p = out + 8;
+        for (uint8_t c = 0; c < channels; ++c, p += 2)
+            sample_log::put16(p, firstValues[c]);
+        *p++ = timestampBits;
+        for (uint8_t c = 0; c < channels; ++c)
+            *p++ = valueBits[c];
+
+        uint64_t bits = 0;
+        uint8_t used = 0;
+        for (uint16_t i = 0; i + 1 < count; ++i) {
+            for (uint8_t f = 0; f <= channels; ++f) {
+                uint8_t width = f == 0 ? timestampBits : valueBits[f - 1];
+                bits |= (uint64_t)deltas[i][f] << used;
+                used += width;
+                while (used >= 8) {
+                    *p++ = (uint8_t)bits;
+                    bits >>= 8;
+                    used -= 8;
+                }
+            }
+        }
+        if (used > 0)
+            *p++ = (uint8_t)bits;
+
+        count = 0;
+        sessionStart = false;
+        return p - out;
+    }
+
+private:
+    uint8_t channels = 0;
+    uint16_t limit = SAMPLE_BLOCK_MAX_SAMPLES;
+    uint16_t count = 0;
+    bool sessionStart = false;
+    uint32_t firstTimestamp = 0;
+    uint32_t lastTimestamp = 0;
+    int32_t lastDelta = 0;
+    uint16_t firstValues[SAMPLE_LOG_MAX_CHANNELS] = {};
+    uint16_t lastValues[SAMPLE_LOG_MAX_CHANNELS] = {};
+    uint32_t timestampMask = 0;
+    uint32_t valueMask[SAMPLE_LOG_MAX_CHANNELS] = {};
+    uint32_t deltas[SAMPLE_BLOCK_MAX_SAMPLES - 1][1 + SAMPLE_LOG_MAX_CHANNELS];
+};
+
+///@brief unpacks blocks of a version 2 log; like SampleLogDecoder it only needs bytes, not a file
+class SampleBlockDecoder {
+public:
+    // length of the complete block at data, 0 if it is cut off (a torn tail) or not a block
+    static size_t blockSize(const SampleLogHeader& header, const uint8_t* data, size_t length) {
+        size_t headerSize = SAMPLE_BLOCK_HEADER_SIZE(header.channelCount);
+        if (length < headerSize)
+            return 0;
+        uint16_t count = sample_log::get16(data) & SAMPLE_BLOCK_COUNT_MASK;
+        uint16_t payload = sample_log::get16(data + 2);
+        const uint8_t* widths = data + 8 + 2 * header.channelCount;
+        size_t bitsPerSample = 0;
+        for (uint8_t f = 0; f <= header.channelCount; ++f) {
+            if (widths[f] > SAMPLE_BLOCK_MAX_BITS)
+                return 0;
+            bitsPerSample += widths[f];
+        }
+        if (count == 0 || count > SAMPLE_BLOCK_MAX_SAMPLES || payload != ((count - 1) * bitsPerSample + 7) / 8 ||
+            length < headerSize + payload)
+            return 0;
+        return headerSize + payload;
+    }
+
+    static uint32_t firstTimestamp(const uint8_t* block) {
+        return sample_log::get32(block + 4);
+    }
+
+    // the block's first sample is the first of a logging session, nothing was sampled between it and the record
+    // before it
+    static bool sessionStart(const uint8_t* block) {
+        return (sample_log::get16(block) & SAMPLE_BLOCK_SESSION_START) != 0;
+    }
+
+    // fills timestamps[n] and values[n * channelCount] (SAMPLE_BLOCK_MAX_SAMPLES rows suffice), returns n;
+    // 0 if blockSize() would
+    static uint16_t decode(const SampleLogHeader& header, const uint8_t* data, size_t length, uint32_t* timestamps,
+                           uint16_t* values) {
+        if (blockSize(header, data, length) == 0)
+            return 0;
+        const uint8_t channels = header.channelCount;
+        uint16_t count = sample_log::get16(data) & SAMPLE_BLOCK_COUNT_MASK;
+        timestamps[0] = sample_log::get32(data + 4);
+        for (uint8_t c = 0; c < channels; ++c)
+            values[c] = sample_log::get16(data + 8 + 2 * c);
+        const uint8_t* widths = data + 8 + 2 * channels;
+        const uint8_t* p = widths + 1 + channels;
+
+        uint64_t bits = 0;
+        uint8_t available = 0;
+        int32_t delta = 0;
+        for (uint16_t i = 1; i < count; ++i) {
+            for (uint8_t f = 0; f <= channels; ++f) {
+                uint8_t width = widths[f];
+                while (available < width) {
+                    bits |= (uint64_t)*p++ << available;
+                    available += 8;
+                }
+                uint32_t z = (uint32_t)(bits & ((1u << width) - 1));
+                bits >>= width;
+                available -= width;
+                if (f == 0) {
+                    delta += sample_codec::unzigzag(z);
+                    timestamps[i] = timestamps[i - 1] + delta;
+                } else {
+                    values[i * channels + f - 1] =
+                        (uint16_t)(values[(i - 1) * channels + f - 1] + sample_codec::unzigzag(z));
+                }
+            }
+        }
+        return count;
+    }
+};
+
+#endif
@@ -0,0 +1,252 @@
+#ifndef SAMPLE_LOG_H
+#define SAMPLE_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "sample_pipeline.h"
+
+// Binary sensor log, version 1. All integers little endian.
+//   header  "SMLG" | u8 version | u8 channelCount | u16 recordSize | u32 samplePeriodMs | u32 createdUnix
+//           channelCount x { char name[8] (NUL padded) | u8 pin | u8 deadband | u16 heartbeatSeconds }
+//   records u32 timestamp | channelCount x u16 value, back to back until the end of the file
+// Fixed size records keep the file seekable by sample index and let a cut-off tail be detected and dropped.
+// deadband and heartbeatSeconds are the channel's ChannelLogging, 0 (every sample) in files of older firmware.
+// When every channel has a deadband the log is change triggered, see deadband.h for what its gaps mean.
+//
+// Rollup files ("SMRU") share the header; samplePeriodMs is the bucket length and each record is
+//   u32 bucketStart | u16 count | channelCount x { u16 min | u16 max | u16 mean }
+// A bucket can appear twice when a reboot split it, readers merge records with the same bucketStart.
+//
+// Version 2 logs keep the header (recordSize still names the uncompressed record) and store the samples in
+// independently decodable blocks instead of records, see sample_codec.h.
+
+#define SAMPLE_LOG_EXT ".bin"
+#define SAMPLE_LOG_VERSION 1
+#define SAMPLE_LOG_VERSION_BLOCKS 2
+#define SAMPLE_LOG_MAX_CHANNELS 8
+#define SAMPLE_LOG_NAME_LEN 8
+#define SAMPLE_LOG_FIXED_HEADER 16
+#define SAMPLE_LOG_CHANNEL_SIZE 12
+#define SAMPLE_LOG_MAX_HEADER (SAMPLE_LOG_FIXED_HEADER + SAMPLE_LOG_CHANNEL_SIZE * SAMPLE_LOG_MAX_CHANNELS)
+#define SAMPLE_LOG_RECORD_SIZE (4 + 2 * SENSOR_CHANNEL_COUNT)  // a SensorSample, the header names the channels
+
+static_assert(SENSOR_CHANNEL_COUNT <= SAMPLE_LOG_MAX_CHANNELS, "more channels than a log header holds");
+static_assert(sensor_channels::namesFit(SAMPLE_LOG_NAME_LEN), "channel names are 1 to 8 characters");
+
+static constexpr uint8_t SAMPLE_LOG_MAGIC[4] = {'S', 'M', 'L', 'G'};
+static constexpr uint8_t SAMPLE_LOG_ROLLUP_MAGIC[4] = {'S', 'M', 'R', 'U'};
+
+struct SampleLogChannel {
+    char name[SAMPLE_LOG_NAME_LEN + 1];
+    uint8_t pin;
+    uint8_t deadband;
+    uint16_t heartbeatSeconds;
+};
+
+struct SampleLogHeader {
+    bool rollup = false;
+    uint8_t version = SAMPLE_LOG_VERSION;
+    uint8_t channelCount = 0;
+    uint16_t recordSize = 0;
+    uint32_t samplePeriodMs = 0;
+    uint32_t createdUnix = 0;
+    SampleLogChannel channels[SAMPLE_LOG_MAX_CHANNELS] = {};
+
+    bool addChannel(const char* name, uint8_t pin, uint8_t deadband = 0, uint16_t heartbeatSeconds = 0) {
+        if (channelCount >= SAMPLE_LOG_MAX_CHANNELS)
+            return false;
+        SampleLogChannel& c = channels[channelCount++];
+        strncpy(c.name, name, SAMPLE_LOG_NAME_LEN);
+        c.name[SAMPLE_LOG_NAME_LEN] = '\0';
+        c.pin = pin;
+        c.deadband = deadband;
+        c.heartbeatSeconds = heartbeatSeconds;
+        recordSize = expectedRecordSize();
+        return true;
+    }
+
+    bool blocks() const {
+        return version == SAMPLE_LOG_VERSION_BLOCKS;
+    }
+
+    // change triggered: a sample was only logged when some channel left its deadband or the heartbeat passed.
+    // One channel that logs every sample makes every sample a record
+    bool deadbanded() const {
+        for (uint8_t i = 0; i < channelCount; ++i)
+            if (channels[i].deadband == 0)
+                return false;
+        return channelCount > 0;
+    }
+
+    // the longest a deadbanded log goes without a record while sampling, 0 for one that logs every sample
+    uint32_t heartbeatSeconds() const {
+        if (!deadbanded())
+            return 0;
+        uint32_t heartbeat = UINT32_MAX;
+        for (uint8_t i = 0; i < channelCount; ++i)
+            if (channels[i].heartbeatSeconds < heartbeat)
+                heartbeat = channels[i].heartbeatSeconds;
+        return heartbeat;
+    }
+
+    // same channels logged the same way, so records of both can share a file
+    bool sameChannels(const SampleLogHeader& other) const {
+        if (channelCount != other.channelCount)
+            return false;
+        for (uint8_t i = 0; i < channelCount; ++i) {
+            const SampleLogChannel& a = channels[i];
+            const SampleLogChannel& b = other.channels[i];
+            if (strcmp(a.name, b.name) != 0 || a.deadband != b.deadband || a.heartbeatSeconds != b.heartbeatSeconds)
+                return false;
+        }
+        return true;
+    }
+
+    uint16_t expectedRecordSize() const {
+        return rollup ? 6 + 6 * channelCount : 4 + 2 * channelCount;
+    }
+
+    size_t encodedSize() const {
+        return SAMPLE_LOG_FIXED_HEADER + SAMPLE_LOG_CHANNEL_SIZE * channelCount;
+    }
+};
+
+namespace sample_log {
+
+inline void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+inline void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+inline uint16_t get16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+inline uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+}  // namespace sample_log
+
+///@brief writes the header once per file and records into a caller buffer; no allocation, no formatting
+class SampleLogEncoder {
+public:
+    // returns the bytes written, 0 if out is too small
+    static size_t encodeHeader(const SampleLogHeader& header, uint8_t* out, size_t capacity) {
+        size_t size = header.encodedSize();
+        if (capacity < size)
+            return 0;
+        memcpy(out, header.rollup ? SAMPLE_LOG_ROLLUP_MAGIC : SAMPLE_LOG_MAGIC, 4);
+        out[4] = header.version;
+        out[5] = header.channelCount;
+        sample_log::put16(out + 6, header.recordSize);
+        sample_log::put32(out + 8, header.samplePeriodMs);
+        sample_log::put32(out + 12, header.createdUnix);
+        uint8_t* p = out + SAMPLE_LOG_FIXED_HEADER;
+        for (uint8_t i = 0; i < header.channelCount; ++i, p += SAMPLE_LOG_CHANNEL_SIZE) {
+            memset(p, 0, SAMPLE_LOG_CHANNEL_SIZE);
+            memcpy(p, header.channels[i].name, strnlen(header.channels[i].name, SAMPLE_LOG_NAME_LEN));
+            p[SAMPLE_LOG_NAME_LEN] = header.channels[i].pin;
+            p[SAMPLE_LOG_NAME_LEN + 1] = header.channels[i].deadband;
+            sample_log::put16(p + SAMPLE_LOG_NAME_LEN + 2, header.channels[i].heartbeatSeconds);
+        }
+        return size;
+    }
+
+    static size_t encodeRecord(const SensorSample& sample, uint8_t* out) {
+        sample_log::put32(out, sample.timestamp);
+        forEachChannel([&](auto i) { sample_log::put16(out + 4 + 2 * i, sample.values[i]); });
+        return SAMPLE_LOG_RECORD_SIZE;
+    }
+
+    // the channels of SENSOR_CHANNELS into a header
+    static void describeChannels(SampleLogHeader& header) {
+        forEachChannel([&](auto i) {
+            const SensorChannel& c = SENSOR_CHANNELS[i];
+            header.addChannel(c.name, c.pin, c.logging.deadband, c.logging.heartbeatSeconds);
+        });
+    }
+
+    // a whole pipeline batch into one buffer, so the file sees a single write()
+    static size_t encodeBatch(const SensorSample* batch, size_t count, uint8_t* out) {
+        for (size_t i = 0; i < count; ++i)
+            encodeRecord(batch[i], out + i * SAMPLE_LOG_RECORD_SIZE);
+        return count * SAMPLE_LOG_RECORD_SIZE;
+    }
+};
+
+///@brief parses what SampleLogEncoder wrote; works on any byte source so the web server, host tools and tests share it
+class SampleLogDecoder {
+public:
+    // fills header from the first bytes of a file, returns its length or 0 if this is not a v1 / v2 log or a rollup
+    static size_t decodeHeader(const uint8_t* data, size_t length, SampleLogHeader& header) {
+        if (length < SAMPLE_LOG_FIXED_HEADER)
+            return 0;
+        if (memcmp(data, SAMPLE_LOG_MAGIC, 4) == 0)
+            header.rollup = false;
+        else if (memcmp(data, SAMPLE_LOG_ROLLUP_MAGIC, 4) == 0)
+            header.rollup = true;
+        else
+            return 0;
+        header.version = data[4];
+        header.channelCount = data[5];
+        header.recordSize = sample_log::get16(data + 6);
+        header.samplePeriodMs = sample_log::get32(data + 8);
+        header.createdUnix = sample_log::get32(data + 12);
+        bool known = header.version == SAMPLE_LOG_VERSION || (header.blocks() && !header.rollup);
+        if (!known || header.channelCount > SAMPLE_LOG_MAX_CHANNELS ||
+            header.recordSize != header.expectedRecordSize())
+            return 0;
+        size_t size = header.encodedSize();
+        if (length < size)
+            return 0;
+        const uint8_t* p = data + SAMPLE_LOG_FIXED_HEADER;
+        for (uint8_t i = 0; i < header.channelCount; ++i, p += SAMPLE_LOG_CHANNEL_SIZE) {
+            memcpy(header.channels[i].name, p, SAMPLE_LOG_NAME_LEN);
+            header.channels[i].name[SAMPLE_LOG_NAME_LEN] = '\0';
+            header.channels[i].pin = p[SAMPLE_LOG_NAME_LEN];
+            header.channels[i].deadband = p[SAMPLE_LOG_NAME_LEN + 1];
+            header.channels[i].heartbeatSeconds = sample_log::get16(p + SAMPLE_LOG_NAME_LEN + 2);
+        }
+        return size;
+    }
+
+    // one record of recordSize bytes: timestamp plus up to SAMPLE_LOG_MAX_CHANNELS values, returns the channel count
+    static uint8_t decodeRecord(const SampleLogHeader& header, const uint8_t* record, uint32_t& timestamp, uint16_t* values) {
+        timestamp = sample_log::get32(record);
+        for (uint8_t i = 0; i < header.channelCount; ++i)
+            values[i] = sample_log::get16(record + 4 + 2 * i);
+        return header.channelCount;
+    }
+
+    // one rollup record: bucket start, sample count and min / max / mean per channel
+    static uint8_t decodeRollup(const SampleLogHeader& header, const uint8_t* record, uint32_t& bucketStart,
+                                uint16_t& count, uint16_t* minValues, uint16_t* maxValues, uint16_t* meanValues) {
+        bucketStart = sample_log::get32(record);
+        count = sample_log::get16(record + 4);
+        for (uint8_t i = 0; i < header.channelCount; ++i) {
+            const uint8_t* channel = record + 6 + 6 * i;
+            minValues[i] = sample_log::get16(channel);
+            maxValues[i] = sample_log::get16(channel + 2);
+            meanValues[i] = sample_log::get16(channel + 4);
+        }
+        return header.channelCount;
+    }
+
+    // complete records in a v1 file of fileSize bytes, a torn last record is ignored
+    static size_t recordCount(const SampleLogHeader& header, size_t fileSize) {
+        size_t headerSize = header.encodedSize();
+        return fileSize > headerSize ? (fileSize - headerSize) / header.recordSize : 0;
+    }
+};
+
+#endif
@@ -0,0 +1,271 @@
+#ifndef SAMPLE_LOG_READER_H
+#define SAMPLE_LOG_READER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "sample_codec.h"
+#include "sample_log.h"
+
+// Sparse index of a version 2 log, a sidecar in an index/ directory next to the log (see indexPath()):
+//   "SMIX" | u8 version | u8 reserved[3], then entries u32 firstTimestamp | u32 offset, one per block
+// in file order. Entries are only written for committed blocks, so every offset is inside the log.
+
+#define SAMPLE_INDEX_EXT ".idx"
+#define SAMPLE_INDEX_DIR "index/"
+#define SAMPLE_INDEX_VERSION 1
+#define SAMPLE_INDEX_HEADER 8
+#define SAMPLE_INDEX_ENTRY 8
+
+static constexpr uint8_t SAMPLE_INDEX_MAGIC[4] = {'S', 'M', 'I', 'X'};
+
+namespace sample_index {
+
+// "/logs/20250714_05.bin" -> "/logs/index/20250714_05.idx"; false if out is too small
+inline bool indexPath(const char* logPath, char* out, size_t capacity) {
+    const char* slash = strrchr(logPath, '/');
+    size_t dirLength = slash ? slash - logPath + 1 : 0;
+    const char* name = logPath + dirLength;
+    const char* dot = strrchr(name, '.');
+    size_t nameLength = dot ? (size_t)(dot - name) : strlen(name);
+    size_t length = dirLength + strlen(SAMPLE_INDEX_DIR) + nameLength + strlen(SAMPLE_INDEX_EXT);
+    if (length + 1 > capacity)
+        return false;
+    memcpy(out, logPath, dirLength);
+    strcpy(out + dirLength, SAMPLE_INDEX_DIR);
+    memcpy(out + dirLength + strlen(SAMPLE_INDEX_DIR), name, nameLength);
+    strcpy(out + length - strlen(SAMPLE_INDEX_EXT), SAMPLE_INDEX_EXT);
+    return true;
+}
+
+inline size_t encodeHeader(uint8_t* out) {
+    memcpy(out, SAMPLE_INDEX_MAGIC, 4);
+    out[4] = SAMPLE_INDEX_VERSION;
+    out[5] = out[6] = out[7] = 0;
+    return SAMPLE_INDEX_HEADER;
+}
+
+inline size_t encodeEntry(uint32_t timestamp, uint32_t offset, uint8_t* out) {
+    sample_log::put32(out, timestamp);
+    sample_log::put32(out + 4, offset);
+    return SAMPLE_INDEX_ENTRY;
+}
+
+}  // namespace sample_index
+
+///@brief the samples of one log file inside a time range, without reading the rest of the file. Version 2 logs
+/// binary search their index for the block to start at, version 1 logs and rollups binary search the fixed size
+/// records; either way a range costs O(log n) small reads plus the range itself, wherever in the file it starts.
+/// range() pushes the whole range to a callback, seek() / next() hand it out one sample at a time for callers that
+/// stop and resume, like a chunked HTTP response. For a rollup the values are the record's u16 fields: the bucket's
+/// sample count, then min / max / mean per channel.
+/// FileT needs read(uint8_t*, size_t), seek(uint32_t) and size(). About 2.5 KB, keep it off small task stacks.
+template <typename FileT>
+class SampleLogReader {
+public:
+    // index may be null or not an index, v2 logs then start their scan at the first block
+    bool open(FileT* logFile, FileT* indexFile) {
+        log = logFile;
+        index = nullptr;
+        bytesRead = 0;
+        done = true;
+        uint8_t buffer[SAMPLE_LOG_MAX_HEADER];
+        size_t length = readAt(*log, 0, buffer, sizeof(buffer));
+        headerSize = SampleLogDecoder::decodeHeader(buffer, length, hdr);
+        if (headerSize == 0)
+            return false;
+        logSize = log->size();
+
+        indexEntries = 0;
+        if (indexFile && hdr.blocks()) {
+            uint8_t magic[SAMPLE_INDEX_HEADER];
+            if (readAt(*indexFile, 0, magic, sizeof(magic)) == sizeof(magic) &&
+                memcmp(magic, SAMPLE_INDEX_MAGIC, 4) == 0 && magic[4] == SAMPLE_INDEX_VERSION) {
+                index = indexFile;
+                indexEntries = (index->size() - SAMPLE_INDEX_HEADER) / SAMPLE_INDEX_ENTRY;
+            }
+        }
+        return true;
+    }
+
+    const SampleLogHeader& header() const {
+        return hdr;
+    }
+
+    // calls fn(timestamp, values) for every sample with from <= timestamp < to, in file order; returns how many.
+    // Assumes timestamps grow through the file, which LogRotation's hour windows keep true short of clock steps
+    template <typename Fn>
+    size_t range(uint32_t from, uint32_t to, Fn fn) {
+        size_t found = 0;
+        uint32_t timestamp;
+        const uint16_t* sample;
+        seek(from, to);
+        while (next(timestamp, sample)) {
+            fn(timestamp, sample);
+            found++;
+        }
+        return found;
+    }
+
+    // positions the cursor on the first sample at or after from, next() stops before to
+    bool seek(uint32_t from, uint32_t to) {
+        done = !log || from >= to;
+        if (done)
+            return false;
+        cursorFrom = from;
+        cursorTo = to;
+        cursorSample = buffered = 0;
+        if (hdr.blocks())
+            nextOffset = blockStartFor(from);
+        else
+            nextRecord = firstRecordAt(from);
+        return true;
+    }
+
+    // the cursor's next sample; values stay valid until the next call. False at to or the end of the file
+    bool next(uint32_t& timestamp, const uint16_t*& sample) {
+        while (!done) {
+            if (cursorSample == buffered) {
+                done = hdr.blocks() ? !loadBlock() : !loadRecords();
+                continue;
+            }
+            uint16_t i = cursorSample++;
+            if (hdr.blocks()) {
+                timestamp = timestamps[i];
+                sample = values + i * hdr.channelCount;
+            } else {
+                const uint8_t* record = block + i * hdr.recordSize;
+                timestamp = sample_log::get32(record);
+                for (uint8_t f = 0; f < (hdr.recordSize - 4) / 2; ++f)
+                    values[f] = sample_log::get16(record + 4 + 2 * f);
+                sample = values;
+                if (timestamp >= cursorTo) {
+                    done = true;
+                    return false;
+                }
+            }
+            if (timestamp >= cursorFrom && timestamp < cursorTo)
+                return true;
+        }
+        return false;
+    }
+
+    // the sample next() returned last is the first of a logging session (see SAMPLE_BLOCK_SESSION_START)
+    bool sessionStart() const {
+        return hdr.blocks() && cursorSample == 1 && blockSession;
+    }
+
+    // bytes read from both files since open(), what a range query costs the card
+    size_t bytesReadSinceOpen() const {
+        return bytesRead;
+    }
+
+private:
+    FileT* log = nullptr;
+    FileT* index = nullptr;
+    SampleLogHeader hdr;
+    size_t headerSize = 0;
+    size_t logSize = 0;
+    size_t indexEntries = 0;
+    size_t bytesRead = 0;
+    uint8_t block[SAMPLE_BLOCK_MAX_SIZE];
+    uint32_t timestamps[SAMPLE_BLOCK_MAX_SAMPLES];
+    uint16_t values[SAMPLE_BLOCK_MAX_SAMPLES * SAMPLE_LOG_MAX_CHANNELS];
+
+    // cursor: the decoded block or the chunk of records in block, and where the next one starts
+    bool done = true;
+    uint32_t cursorFrom = 0;
+    uint32_t cursorTo = 0;
+    uint16_t cursorSample = 0;
+    uint16_t buffered = 0;
+    bool blockSession = false;
+    size_t nextOffset = 0;
+    size_t nextRecord = 0;
+
+    size_t readAt(FileT& file, size_t position, uint8_t* buffer, size_t length) {
+        if (!file.seek((uint32_t)position))
+            return 0;
+        size_t n = file.read(buffer, length);
+        bytesRead += n;
+        return n;
+    }
+
+    // offset of the last indexed block starting before from (a sample at from can end the block before one that
+    // starts at from), the first block without a usable index
+    size_t blockStartFor(uint32_t from) {
+        size_t start = headerSize;
+        size_t lo = 0, hi = indexEntries;  // entries before lo start before from, from hi on at or after it
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            uint8_t entry[SAMPLE_INDEX_ENTRY];
+            if (readAt(*index, SAMPLE_INDEX_HEADER + mid * SAMPLE_INDEX_ENTRY, entry, sizeof(entry)) != sizeof(entry))
+                break;
+            if (sample_log::get32(entry) < from) {
+                uint32_t offset = sample_log::get32(entry + 4);
+                if (offset >= headerSize && offset < logSize)
+                    start = offset;
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return start;
+    }
+
+    // decodes the block at nextOffset, false at the end of the file, a torn block or one starting at cursorTo
+    bool loadBlock() {
+        const size_t blockHeader = SAMPLE_BLOCK_HEADER_SIZE(hdr.channelCount);
+        if (nextOffset + blockHeader > logSize)
+            return false;
+        size_t length = readAt(*log, nextOffset, block, blockHeader);
+        if (length < blockHeader || SampleBlockDecoder::firstTimestamp(block) >= cursorTo)
+            return false;
+        // the block header gives the payload length, blockSize() then checks it against the widths
+        size_t payload = sample_log::get16(block + 2);
+        if (blockHeader + payload > sizeof(block) ||
+            readAt(*log, nextOffset + blockHeader, block + blockHeader, payload) != payload)
+            return false;
+        length = SampleBlockDecoder::blockSize(hdr, block, blockHeader + payload);
+        if (length == 0)
+            return false;
+        buffered = SampleBlockDecoder::decode(hdr, block, length, timestamps, values);
+        blockSession = SampleBlockDecoder::sessionStart(block);
+        cursorSample = 0;
+        nextOffset += length;
+        return buffered > 0;
+    }
+
+    // index of the first record at or after from
+    size_t firstRecordAt(uint32_t from) {
+        size_t lo = 0, hi = SampleLogDecoder::recordCount(hdr, logSize);
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            uint8_t ts[4];
+            if (readAt(*log, headerSize + mid * hdr.recordSize, ts, sizeof(ts)) != sizeof(ts))
+                return SampleLogDecoder::recordCount(hdr, logSize);
+            if (sample_log::get32(ts) < from)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    // the next records from nextRecord into block, as many as fit
+    bool loadRecords() {
+        size_t records = SampleLogDecoder::recordCount(hdr, logSize);
+        if (nextRecord >= records)
+            return false;
+        const size_t perChunk = sizeof(block) / hdr.recordSize;
+        size_t n = records - nextRecord < perChunk ? records - nextRecord : perChunk;
+        if (readAt(*log, headerSize + nextRecord * hdr.recordSize, block, n * hdr.recordSize) != n * hdr.recordSize)
+            return false;
+        buffered = (uint16_t)n;
+        cursorSample = 0;
+        nextRecord += n;
+        return true;
+    }
+};
+
+#endif
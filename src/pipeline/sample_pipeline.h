@@ -0,0 +1,229 @@
+#ifndef SAMPLE_PIPELINE_H
+#define SAMPLE_PIPELINE_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "spsc_ring.h"
+#include "../adc/sensor_channels.h"
+#include "../scheduler/inplace_function.h"
+
+#ifdef ESP_PLATFORM
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+#ifndef PIPELINE_RING_SIZE
+#define PIPELINE_RING_SIZE 256
+#endif
+#ifndef PIPELINE_BATCH_SIZE
+#define PIPELINE_BATCH_SIZE 32
+#endif
+
+///@brief one fixed size reading of all channels, this is what travels through the ring
+struct SensorSample {
+    uint32_t timestamp;
+    uint16_t values[SENSOR_CHANNEL_COUNT];  // in SENSOR_CHANNELS order
+};
+
+struct PipelineConfig {
+    unsigned long samplePeriodMs = 1332;  // sampler wake period; the sample function may skip a wake by returning false
+    unsigned long writerIdleMs = 4000;  // writer sleep when the ring is empty, sets the batch size
+    uint8_t samplerCore = 1;
+    uint8_t writerCore = 0;
+    uint8_t samplerPriority = 5;
+    uint8_t writerPriority = 1;
+    uint32_t samplerStack = 4096;
+    uint32_t writerStack = 8192;
+};
+
+struct PipelineStats {
+    size_t depth;
+    size_t maxDepth;
+    size_t capacity;
+    uint32_t produced;
+    uint32_t dropped;
+    uint32_t written;
+    uint32_t batches;
+};
+
+///@brief sampler task fills a SpscRing at a fixed rate, writer task drains it in batches.
+/// On ESP32 both are FreeRTOS tasks pinned to different cores, on the host they are std::threads.
+/// A full ring drops the newest sample and counts it, the sampler never blocks on the writer.
+class SamplePipeline {
+public:
+    typedef InplaceFunction<bool(SensorSample&), 2 * sizeof(void*)> SampleFn;
+    typedef InplaceFunction<void(const SensorSample*, size_t), 2 * sizeof(void*)> WriteFn;
+
+    // sets the callbacks without spawning tasks; the owner then drives it with pump()
+    void begin(SampleFn sampler, WriteFn writer, const PipelineConfig& cfg = PipelineConfig()) {
+        sampleFn = sampler;
+        writeFn = writer;
+        config = cfg;
+    }
+
+    bool start(SampleFn sampler, WriteFn writer, const PipelineConfig& cfg = PipelineConfig()) {
+        if (running.load())
+            return false;
+        begin(sampler, writer, cfg);
+        running.store(true);
+        samplerDone.store(false);
+#ifdef ESP_PLATFORM
+        writerDone.store(false);
+        if (xTaskCreatePinnedToCore(&SamplePipeline::samplerEntry, "sampler", config.samplerStack, this,
+                                    config.samplerPriority, &samplerTask, config.samplerCore) != pdPASS) {
+            running.store(false);
+            return false;
+        }
+        if (xTaskCreatePinnedToCore(&SamplePipeline::writerEntry, "writer", config.writerStack, this,
+                                    config.writerPriority, &writerTask, config.writerCore) != pdPASS) {
+            stop();
+            return false;
+        }
+#else
+        samplerThread = std::thread([this]() { samplerLoop(); });
+        writerThread = std::thread([this]() { writerLoop(); });
+#endif
+        return true;
+    }
+
+    // stops both tasks, the writer drains whatever is left in the ring first
+    void stop() {
+        if (!running.exchange(false))
+            return;
+#ifdef ESP_PLATFORM
+        while ((samplerTask && !samplerDone.load()) || (writerTask && !writerDone.load()))
+            vTaskDelay(pdMS_TO_TICKS(10));
+        samplerTask = nullptr;
+        writerTask = nullptr;
+#else
+        if (samplerThread.joinable()) samplerThread.join();
+        if (writerThread.joinable()) writerThread.join();
+#endif
+    }
+
+    // one sample and a full drain on the calling task, for simulated time where no task may sleep
+    void pump() {
+        sampleOnce();
+        while (drainBatch() > 0) {}
+    }
+
+    const PipelineConfig& getConfig() const {
+        return config;
+    }
+
+    bool isRunning() const {
+        return running.load();
+    }
+
+    PipelineStats stats() const {
+        PipelineStats s;
+        s.depth = ring.size();
+        s.maxDepth = maxDepth.load(std::memory_order_relaxed);
+        s.capacity = ring.capacity();
+        s.produced = produced.load(std::memory_order_relaxed);
+        s.dropped = dropped.load(std::memory_order_relaxed);
+        s.written = written.load(std::memory_order_relaxed);
+        s.batches = batches.load(std::memory_order_relaxed);
+        return s;
+    }
+
+private:
+    SpscRing<SensorSample, PIPELINE_RING_SIZE> ring;
+    SampleFn sampleFn;
+    WriteFn writeFn;
+    PipelineConfig config;
+
+    std::atomic<bool> running{false};
+    std::atomic<size_t> maxDepth{0};
+    std::atomic<uint32_t> produced{0};
+    std::atomic<uint32_t> dropped{0};
+    std::atomic<uint32_t> written{0};
+    std::atomic<uint32_t> batches{0};
+    std::atomic<bool> samplerDone{false};
+
+#ifdef ESP_PLATFORM
+    TaskHandle_t samplerTask = nullptr;
+    TaskHandle_t writerTask = nullptr;
+    std::atomic<bool> writerDone{false};
+
+    static void samplerEntry(void* arg) {
+        SamplePipeline* self = static_cast<SamplePipeline*>(arg);
+        self->samplerLoop();
+        vTaskDelete(nullptr);
+    }
+
+    static void writerEntry(void* arg) {
+        SamplePipeline* self = static_cast<SamplePipeline*>(arg);
+        self->writerLoop();
+        self->writerDone.store(true);
+        vTaskDelete(nullptr);
+    }
+#else
+    std::thread samplerThread;
+    std::thread writerThread;
+#endif
+
+    void samplerLoop() {
+#ifdef ESP_PLATFORM
+        TickType_t lastWake = xTaskGetTickCount();
+#else
+        auto nextWake = std::chrono::steady_clock::now();
+#endif
+        while (running.load(std::memory_order_relaxed)) {
+            sampleOnce();
+#ifdef ESP_PLATFORM
+            vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(config.samplePeriodMs));
+#else
+            nextWake += std::chrono::milliseconds(config.samplePeriodMs);
+            std::this_thread::sleep_until(nextWake);
+#endif
+        }
+        samplerDone.store(true);
+    }
+
+    void sampleOnce() {
+        SensorSample sample;
+        if (!sampleFn(sample))
+            return;
+        produced.fetch_add(1, std::memory_order_relaxed);
+        if (!ring.push(sample))
+            dropped.fetch_add(1, std::memory_order_relaxed);
+
+        size_t depth = ring.size();
+        if (depth > maxDepth.load(std::memory_order_relaxed))
+            maxDepth.store(depth, std::memory_order_relaxed);
+    }
+
+    size_t drainBatch() {
+        SensorSample batch[PIPELINE_BATCH_SIZE];
+        size_t n = ring.popBatch(batch, PIPELINE_BATCH_SIZE);
+        if (n > 0) {
+            writeFn(batch, n);
+            written.fetch_add(n, std::memory_order_relaxed);
+            batches.fetch_add(1, std::memory_order_relaxed);
+        }
+        return n;
+    }
+
+    void writerLoop() {
+        while (true) {
+            bool stopping = samplerDone.load();
+            if (drainBatch() > 0)
+                continue;
+            if (stopping)
+                return;  // sampler is gone and the ring is empty
+#ifdef ESP_PLATFORM
+            vTaskDelay(pdMS_TO_TICKS(config.writerIdleMs));
+#else
+            std::this_thread::sleep_for(std::chrono::milliseconds(config.writerIdleMs));
+#endif
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <stddef.h>
+
+///@brief lock-free single producer / single consumer ring of fixed size records.
+/// push() only ever runs on the producer side, pop()/popBatch() only on the consumer side.
+template<typename T, size_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing: capacity must be a power of two");
+
+public:
+    bool push(const T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= N)
+            return false;  // full, caller counts the drop
+        buffer[h & (N - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& out) {
+        return popBatch(&out, 1) == 1;
+    }
+
+    size_t popBatch(T* out, size_t max) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t available = head.load(std::memory_order_acquire) - t;
+        size_t n = available < max ? available : max;
+        for (size_t i = 0; i < n; ++i)
+            out[i] = buffer[(t + i) & (N - 1)];
+        tail.store(t + n, std::memory_order_release);
+        return n;
+    }
+
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    static constexpr size_t capacity() {
+        return N;
+    }
+
+private:
+    std::atomic<size_t> head{0};
+    std::atomic<size_t> tail{0};
+    T buffer[N];
+};
+
+#endif
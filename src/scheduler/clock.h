@@ -0,0 +1,69 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <stdint.h>
+#include <time.h>
+#include <Arduino.h>
+
+///@brief time source for Scheduler and the services, so the whole app can run on simulated time
+class Clock {
+public:
+    virtual ~Clock() = default;
+    virtual unsigned long millis() const = 0;
+    virtual time_t unixTime() const = 0;
+
+    // false for simulated time: nothing blocks, the caller advance()s the clock instead of sleeping
+    virtual bool realTime() const {
+        return true;
+    }
+    virtual void advance(unsigned long) {}
+};
+
+///@brief millis() and time(nullptr), the default everywhere
+class SystemClock : public Clock {
+public:
+    unsigned long millis() const override {
+        return ::millis();
+    }
+
+    time_t unixTime() const override {
+        return time(nullptr);
+    }
+
+    static SystemClock& instance() {
+        static SystemClock clock;
+        return clock;
+    }
+};
+
+///@brief starts at a fixed unix time and only moves on advance(), a simulated week takes as long as its work does
+class VirtualClock : public Clock {
+public:
+    explicit VirtualClock(time_t startUnix) : startUnix(startUnix) {}
+
+    unsigned long millis() const override {
+        return (unsigned long)elapsedMs;
+    }
+
+    time_t unixTime() const override {
+        return startUnix + (time_t)(elapsedMs / 1000);
+    }
+
+    bool realTime() const override {
+        return false;
+    }
+
+    void advance(unsigned long ms) override {
+        elapsedMs += ms;
+    }
+
+    uint64_t elapsed() const {
+        return elapsedMs;
+    }
+
+private:
+    time_t startUnix;
+    uint64_t elapsedMs = 0;
+};
+
+#endif
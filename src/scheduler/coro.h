@@ -0,0 +1,248 @@
+#ifndef CORO_H
+#define CORO_H
+
+#include <coroutine>
+#include <exception>
+#include <stddef.h>
+#include <stdint.h>
+#include <Arduino.h>
+
+#include "inplace_function.h"
+#include "scheduler.h"
+
+#ifndef CORO_ARENA_SLOTS
+#define CORO_ARENA_SLOTS 4
+#endif
+#ifndef CORO_FRAME_SIZE
+#define CORO_FRAME_SIZE 512
+#endif
+#ifndef CORO_IO_POLL_MS
+#define CORO_IO_POLL_MS 10
+#endif
+
+struct CoroArenaStats {
+    size_t slots;
+    size_t inUse;
+    size_t frameSize;
+    size_t largestFrame;  // biggest frame ever requested, compare against frameSize when adding locals to a coroutine
+    uint32_t failed;
+};
+
+///@brief fixed pool of equally sized coroutine frames, so coroutines never touch the heap.
+/// Only the loop task creates and finishes coroutines, no locking.
+class CoroArena {
+public:
+    static void* allocate(size_t size) {
+        if (size > largest)
+            largest = size;
+        if (size <= CORO_FRAME_SIZE) {
+            for (size_t i = 0; i < CORO_ARENA_SLOTS; ++i) {
+                if (!used[i]) {
+                    used[i] = true;
+                    return frames[i];
+                }
+            }
+        }
+        failed++;
+        Serial.print("CoroArena: no frame for ");
+        Serial.print((unsigned long)size);
+        Serial.println(" bytes");
+        return nullptr;
+    }
+
+    static void release(void* frame) {
+        for (size_t i = 0; i < CORO_ARENA_SLOTS; ++i) {
+            if (frames[i] == frame) {
+                used[i] = false;
+                return;
+            }
+        }
+    }
+
+    static CoroArenaStats stats() {
+        CoroArenaStats s;
+        s.slots = CORO_ARENA_SLOTS;
+        s.inUse = 0;
+        for (bool u : used)
+            s.inUse += u;
+        s.frameSize = CORO_FRAME_SIZE;
+        s.largestFrame = largest;
+        s.failed = failed;
+        return s;
+    }
+
+private:
+    alignas(std::max_align_t) static inline unsigned char frames[CORO_ARENA_SLOTS][CORO_FRAME_SIZE];
+    static inline bool used[CORO_ARENA_SLOTS] = {};
+    static inline size_t largest = 0;
+    static inline uint32_t failed = 0;
+};
+
+///@brief fire and forget coroutine driven by a Scheduler. Write the body as straight-line code and co_await
+/// sleep_for() / until() / ready() / io() wherever the old code would have delay()ed or split into states;
+/// every suspension is a one-shot or polling scheduler task, so the loop keeps running in between.
+/// The frame comes from CoroArena and frees itself when the body returns.
+class Coro {
+public:
+    struct promise_type {
+        Scheduler* scheduler = nullptr;
+        const char* name = "coro";
+
+        static void* operator new(size_t size) noexcept {
+            return CoroArena::allocate(size);
+        }
+
+        static void operator delete(void* frame) noexcept {
+            CoroArena::release(frame);
+        }
+
+        static Coro get_return_object_on_allocation_failure() {
+            return Coro();
+        }
+
+        Coro get_return_object() {
+            return Coro(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    typedef std::coroutine_handle<promise_type> Handle;
+
+    Coro() {}
+    Coro(Coro&& other) : handle(other.handle) { other.handle = nullptr; }
+    Coro(const Coro&) = delete;
+    Coro& operator=(const Coro&) = delete;
+
+    ~Coro() {
+        if (handle)
+            handle.destroy();  // never started
+    }
+
+    // hands the frame to the scheduler, the body runs up to its first co_await on the next update();
+    // name must outlive the coroutine, it labels every task the coroutine waits on
+    bool start(Scheduler& scheduler, const char* name) {
+        if (!handle)
+            return false;
+        handle.promise().scheduler = &scheduler;
+        handle.promise().name = name;
+        Handle h = handle;
+        if (!scheduler.addTask(name, [h]() { h.resume(); }, 0, false).active())
+            return false;  // destructor frees the frame
+        handle = nullptr;
+        return true;
+    }
+
+private:
+    explicit Coro(Handle h) : handle(h) {}
+
+    Handle handle;
+};
+
+///@brief co_await sleep_for(ms): one-shot task that resumes the coroutine
+struct SleepFor {
+    unsigned long ms;
+
+    bool await_ready() const { return false; }
+
+    // an exhausted task pool blocks the loop for ms instead of stranding the frame or cutting the sleep short
+    bool await_suspend(Coro::Handle h) const {
+        Coro::promise_type& p = h.promise();
+        if (p.scheduler->addTask(p.name, [h]() { h.resume(); }, ms, false).active())
+            return true;
+        Serial.printf("Coro: %s has no task to sleep on, blocking for %lu ms\n", p.name, ms);
+        if (p.scheduler->clock().realTime())
+            delay(ms);
+        return false;
+    }
+
+    void await_resume() const {}
+};
+
+inline SleepFor sleep_for(unsigned long ms) {
+    return SleepFor{ms};
+}
+
+///@brief what co_await until() yields: true once the predicate held. unscheduled means the task pool was full
+/// and nothing was waited for, the predicate neither held nor timed out
+struct WaitResult {
+    bool done;
+    bool unscheduled;
+
+    explicit operator bool() const {
+        return done;
+    }
+};
+
+///@brief co_await until(pred, pollMs, timeoutMs): polls pred from a repeating task, yields true once it holds
+/// or false after timeoutMs (0 waits forever). Already true means no suspension at all.
+class Until {
+public:
+    typedef InplaceFunction<bool(), 2 * sizeof(void*)> Predicate;
+
+    Until(Predicate pred, unsigned long pollMs, unsigned long timeoutMs) : pred(pred), pollMs(pollMs), timeoutMs(timeoutMs) {}
+
+    bool await_ready() {
+        result = pred();
+        return result;
+    }
+
+    bool await_suspend(Coro::Handle h) {
+        handle = h;
+        Scheduler* scheduler = h.promise().scheduler;
+        started = scheduler->clock().millis();
+        clock = &scheduler->clock();
+        Until* self = this;
+        task = scheduler->addTask(h.promise().name, [self]() { self->poll(); }, pollMs, true);
+        if (task.active())
+            return true;
+        Serial.printf("Coro: %s has no task to wait on, task pool exhausted\n", h.promise().name);
+        unscheduled = true;
+        return false;
+    }
+
+    WaitResult await_resume() const {
+        return WaitResult{result, unscheduled};
+    }
+
+private:
+    Predicate pred;
+    unsigned long pollMs;
+    unsigned long timeoutMs;
+    unsigned long started = 0;
+    bool result = false;
+    bool unscheduled = false;
+    Coro::Handle handle;
+    TaskHandle task;
+    Clock* clock = nullptr;
+
+    void poll() {
+        result = pred();
+        if (!result && (timeoutMs == 0 || clock->millis() - started < timeoutMs))
+            return;
+        task.cancel();
+        handle.resume();  // may finish the coroutine and free this awaiter with it, nothing after this line
+    }
+};
+
+inline Until until(Until::Predicate pred, unsigned long pollMs, unsigned long timeoutMs = 0) {
+    return Until(pred, pollMs, timeoutMs);
+}
+
+// co_await ready(service): wait for another service's ready(), polled every 50 ms
+template<typename S>
+inline Until ready(const S& service, unsigned long timeoutMs = 0) {
+    const S* s = &service;
+    return Until([s]() { return s->ready(); }, 50, timeoutMs);
+}
+
+// co_await io(done): wait for a device operation started without blocking (WiFi.begin(), an async scan, a write
+// handed to the other core), polled every CORO_IO_POLL_MS since these finish within milliseconds to seconds
+inline Until io(Until::Predicate done, unsigned long timeoutMs = 0) {
+    return Until(done, CORO_IO_POLL_MS, timeoutMs);
+}
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef INPLACE_FUNCTION_H
+#define INPLACE_FUNCTION_H
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename Signature, size_t Capacity>
+class InplaceFunction;
+
+///@brief std::function replacement that keeps the callable in a fixed inline buffer, never allocates.
+/// Only trivially copyable callables are accepted (lambdas capturing pointers / plain values), so moving is a memcpy.
+template<typename R, typename... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+public:
+    InplaceFunction() {}
+    InplaceFunction(std::nullptr_t) {}
+
+    template<typename F, typename = typename std::enable_if<
+        !std::is_same<typename std::decay<F>::type, InplaceFunction>::value>::type>
+    InplaceFunction(F&& f) {
+        typedef typename std::decay<F>::type Callable;
+        static_assert(sizeof(Callable) <= Capacity, "InplaceFunction: capture too large, capture a pointer instead");
+        static_assert(alignof(Callable) <= alignof(std::max_align_t), "InplaceFunction: over-aligned capture");
+        static_assert(std::is_trivially_copyable<Callable>::value && std::is_trivially_destructible<Callable>::value,
+                      "InplaceFunction: capture must be trivially copyable (pointers, ints, handles)");
+        new (storage) Callable(std::forward<F>(f));
+        invoker = &invoke<Callable>;
+    }
+
+    InplaceFunction(const InplaceFunction& other) = default;
+    InplaceFunction& operator=(const InplaceFunction& other) = default;
+
+    R operator()(Args... args) const {
+        return invoker(storage, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const {
+        return invoker != nullptr;
+    }
+
+private:
+    template<typename Callable>
+    static R invoke(const void* data, Args&&... args) {
+        return (*const_cast<Callable*>(static_cast<const Callable*>(data)))(std::forward<Args>(args)...);
+    }
+
+    alignas(std::max_align_t) unsigned char storage[Capacity] = {};
+    R (*invoker)(const void*, Args&&...) = nullptr;
+};
+
+#endif
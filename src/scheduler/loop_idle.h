@@ -0,0 +1,107 @@
+#ifndef LOOP_IDLE_H
+#define LOOP_IDLE_H
+
+#include <stdint.h>
+#include <Arduino.h>
+
+#ifdef ESP_PLATFORM
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_pm.h>
+#else
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#endif
+
+struct LoopStats {
+    uint32_t wakeupsPerSec = 0;   // last full one second window
+    uint8_t idlePercent = 0;      // share of that window spent blocked
+    uint32_t wakeups = 0;         // since boot
+    uint64_t idleUs = 0;
+};
+
+///@brief blocks the loop task until a deadline or until wake() is called from another task (HTTP handler, DNS, pipeline).
+/// While blocked the IDLE task runs, which lets the CPU clock down and, when the core is built with tickless idle,
+/// enter automatic light sleep.
+class LoopIdle {
+public:
+    // must run on the loop task, wake() notifies whichever task bound last
+    void begin() {
+#ifdef ESP_PLATFORM
+        task = xTaskGetCurrentTaskHandle();
+#if CONFIG_PM_ENABLE && CONFIG_FREERTOS_USE_TICKLESS_IDLE
+        esp_pm_config_t pm = {};
+        pm.max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+        pm.min_freq_mhz = 40;
+        pm.light_sleep_enable = true;
+        if (esp_pm_configure(&pm) != ESP_OK)
+            Serial.println("LoopIdle: automatic light sleep not available.");
+#endif
+#endif
+        windowStart = millis();
+    }
+
+    void wake() {
+#ifdef ESP_PLATFORM
+        if (task && task != xTaskGetCurrentTaskHandle())
+            xTaskNotifyGive(task);
+#else
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            woken = true;
+        }
+        cond.notify_one();
+#endif
+    }
+
+    void sleepFor(unsigned long ms) {
+        unsigned long startUs = micros();
+        if (ms > 0) {
+#ifdef ESP_PLATFORM
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms));
+#else
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait_for(lock, std::chrono::milliseconds(ms), [this]() { return woken; });
+            woken = false;
+#endif
+        }
+        record(micros() - startUs);
+    }
+
+    LoopStats stats() const {
+        return current;
+    }
+
+private:
+#ifdef ESP_PLATFORM
+    TaskHandle_t task = nullptr;
+#else
+    std::mutex mutex;
+    std::condition_variable cond;
+    bool woken = false;
+#endif
+    LoopStats current;
+    unsigned long windowStart = 0;
+    uint32_t windowWakeups = 0;
+    uint64_t windowIdleUs = 0;
+
+    void record(unsigned long idleUs) {
+        current.wakeups++;
+        current.idleUs += idleUs;
+        windowWakeups++;
+        windowIdleUs += idleUs;
+
+        unsigned long elapsed = millis() - windowStart;
+        if (elapsed < 1000)
+            return;
+        current.wakeupsPerSec = (uint32_t)(windowWakeups * 1000UL / elapsed);
+        uint64_t percent = windowIdleUs / 10 / elapsed;
+        current.idlePercent = percent > 100 ? 100 : (uint8_t)percent;
+        windowStart += elapsed;
+        windowWakeups = 0;
+        windowIdleUs = 0;
+    }
+};
+
+#endif
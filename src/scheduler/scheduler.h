@@ -1,47 +1,394 @@
 #ifndef SCHEDULER_H
 #define SCHEDULER_H
 
-#include <vector>
-#include <functional>
+#include <stdint.h>
 #include <Arduino.h>
 
+#include "clock.h"
+#include "inplace_function.h"
+#include "loop_idle.h"
+
+#ifndef SCHEDULER_MAX_TASKS
+#define SCHEDULER_MAX_TASKS 16
+#endif
+#define SCHEDULER_CAPTURE_SIZE (2 * sizeof(void*))
+#define SCHEDULER_HIST_BUCKETS 8
+#ifndef SCHEDULER_MAX_IDLE_MS
+#define SCHEDULER_MAX_IDLE_MS 1000
+#endif
+
+typedef InplaceFunction<void(), SCHEDULER_CAPTURE_SIZE> TaskCallback;
+typedef uint16_t TaskSlot;
+
+class Scheduler;
+
+// upper bounds of the callback time histogram, the last bucket takes everything above
+static constexpr uint32_t SCHEDULER_HIST_BOUNDS_US[SCHEDULER_HIST_BUCKETS - 1] = {100, 500, 1000, 5000, 10000, 50000, 100000};
+
+///@brief per task dispatch statistics, a handful of integer ops per run so it stays on in production
+struct TaskStats {
+    uint32_t runs = 0;
+    uint32_t lateMaxMs = 0;      // dispatch time minus deadline
+    uint64_t lateSumMs = 0;
+    uint32_t execMinUs = 0;      // callback duration
+    uint32_t execMaxUs = 0;
+    uint64_t execSumUs = 0;
+    uint32_t missedPeriods = 0;  // runs that started a whole interval or more late
+    uint32_t catchUpBursts = 0;  // deadline += interval still in the past, task will run back to back
+    uint32_t histogram[SCHEDULER_HIST_BUCKETS] = {};
+
+    void record(unsigned long lateMs, unsigned long execUs, unsigned long interval_ms) {
+        if (runs == 0 || execUs < execMinUs) execMinUs = execUs;
+        if (execUs > execMaxUs) execMaxUs = execUs;
+        if (lateMs > lateMaxMs) lateMaxMs = lateMs;
+        execSumUs += execUs;
+        lateSumMs += lateMs;
+        if (interval_ms > 0 && lateMs >= interval_ms)
+            missedPeriods++;
+        uint8_t bucket = 0;
+        while (bucket < SCHEDULER_HIST_BUCKETS - 1 && execUs >= SCHEDULER_HIST_BOUNDS_US[bucket])
+            bucket++;
+        histogram[bucket]++;
+        runs++;
+    }
+};
+
+///@brief returned by Scheduler::addTask; goes stale (all calls become no-ops) once the task is cancelled or a one-shot task has run
+class TaskHandle {
+public:
+    TaskHandle() {}
+
+    bool cancel();
+    bool reschedule(unsigned long interval_ms);
+    bool pause();
+    bool resume();
+    bool active() const;
+
+private:
+    friend class Scheduler;
+
+    TaskHandle(Scheduler* owner, TaskSlot slot, uint16_t generation) : owner(owner), slot(slot), generation(generation) {}
+
+    Scheduler* owner = nullptr;
+    TaskSlot slot = 0;
+    uint16_t generation = 0;
+};
+
+///@brief deadline ordered timer queue over a fixed task pool; update() only looks at the earliest deadline so idle loops cost O(1),
+/// each dispatch O(log n). Nothing here allocates, tasks live in slots[] and the heap holds slot indices.
 class Scheduler {
 public:
-    Scheduler() {}
+    Scheduler() {
+        for (TaskSlot i = 0; i < SCHEDULER_MAX_TASKS; ++i)
+            freeSlots[i] = SCHEDULER_MAX_TASKS - 1 - i;
+        freeCount = SCHEDULER_MAX_TASKS;
+    }
 
-    // Add a task: callback returns void; repeat controls if task runs repeatedly
-    void addTask(std::function<void()> cb, unsigned long interval_ms, bool repeat = true) {
-        unsigned long now = millis();
-        tasks.push_back({cb, interval_ms, now, repeat});
+    // Add a task: callback returns void; repeat controls if task runs repeatedly; name must be a literal or otherwise outlive the task
+    TaskHandle addTask(const char* name, TaskCallback cb, unsigned long interval_ms, bool repeat = true) {
+        if (freeCount == 0) {
+            Serial.print("Scheduler: task pool exhausted, dropping task ");
+            Serial.println(name);
+            return TaskHandle();
+        }
+        TaskSlot idx = freeSlots[--freeCount];
+        Slot& s = slots[idx];
+        s.name = name;
+        s.stats = TaskStats();
+        s.callback = cb;
+        s.interval_ms = interval_ms;
+        s.deadline = clk->millis() + interval_ms;
+        s.pass = passCount;
+        s.used = true;
+        s.repeat = repeat;
+        s.paused = false;
+        s.cancelled = false;
+        s.rescheduled = false;
+        push(idx);
+        idle.wake();
+        return TaskHandle(this, idx, s.generation);
     }
 
     void update() {
-        unsigned long now = millis();
-        for (auto it = tasks.begin(); it != tasks.end(); ) {
-            unsigned long elapsed = now - it->last_run;
-            if (elapsed >= it->interval_ms) {
-                it->callback();
-                if (it->repeat) {
-                    it->last_run += it->interval_ms;
-                    ++it;
-                } else {
-                    it = tasks.erase(it);
-                }
-            } else {
-                ++it;
+        unsigned long now = clk->millis();
+        if (heapSize == 0 || !isDue(slots[heap[0]], now))
+            return;
+
+        // every task runs at most once per update(), like the old linear pass did: one that already ran and is
+        // still due (catching up), or was added by a callback, is set aside so the tasks behind it get their turn
+        unsigned long pass = ++passCount;
+        TaskSlot deferred[SCHEDULER_MAX_TASKS];
+        TaskSlot deferredCount = 0;
+        while (heapSize > 0 && isDue(slots[heap[0]], now)) {
+            TaskSlot idx = heap[0];
+            Slot& s = slots[idx];
+            if (s.pass == pass) {
+                if (deferredCount == SCHEDULER_MAX_TASKS)
+                    break;
+                removeAt(0);
+                deferred[deferredCount++] = idx;
+                continue;
             }
+            removeAt(0);
+
+            unsigned long lateMs = clk->millis() - s.deadline;
+            unsigned long startUs = micros();  // callback cost is CPU time, real even on a VirtualClock
+            running = idx;  // cancel()/reschedule()/pause() from inside the callback only set flags
+            s.callback();
+            running = NONE;
+            s.stats.record(lateMs, micros() - startUs, s.repeat ? s.interval_ms : 0);
+
+            if (s.cancelled || !s.repeat) {
+                release(idx);
+                continue;
+            }
+            if (s.paused)
+                continue;
+            if (s.rescheduled)
+                s.rescheduled = false;
+            else
+                s.deadline += s.interval_ms;
+            if (s.interval_ms > 0 && isDue(s, now))
+                s.stats.catchUpBursts++;
+            s.pass = pass;
+            push(idx);
+        }
+
+        // back into the heap unless a later callback cancelled, paused or already re-added it
+        for (TaskSlot i = 0; i < deferredCount; ++i) {
+            Slot& s = slots[deferred[i]];
+            if (s.used && !s.cancelled && !s.paused && s.heapPos == NONE)
+                push(deferred[i]);
+        }
+    }
+
+    // Absolute millis() of the earliest pending task, false if nothing is scheduled
+    bool nextDeadline(unsigned long& deadline) const {
+        if (heapSize == 0)
+            return false;
+        deadline = slots[heap[0]].deadline;
+        return true;
+    }
+
+    // time source for deadlines and for the services; swap before any task is added
+    void setClock(Clock& c) {
+        clk = &c;
+    }
+
+    Clock& clock() const {
+        return *clk;
+    }
+
+    // binds the idle wait to the calling (loop) task
+    void begin() {
+        idle.begin();
+    }
+
+    // block until the earliest task is due, wake() is called or maxWaitMs passes; a simulated clock jumps there instead
+    void sleepUntilNext(unsigned long maxWaitMs = SCHEDULER_MAX_IDLE_MS) {
+        unsigned long wait = maxWaitMs;
+        if (heapSize > 0) {
+            long untilDue = (long)(slots[heap[0]].deadline - clk->millis());
+            if (untilDue <= 0)
+                wait = 0;
+            else if ((unsigned long)untilDue < wait)
+                wait = untilDue;
+        }
+        if (!clk->realTime()) {
+            clk->advance(wait);
+            return;
+        }
+        idle.sleepFor(wait);
+    }
+
+    // for other tasks that changed something the loop has to look at
+    void wake() {
+        idle.wake();
+    }
+
+    LoopStats loopStats() const {
+        return idle.stats();
+    }
+
+    size_t taskCount() const {
+        return SCHEDULER_MAX_TASKS - freeCount;
+    }
+
+    // fn(const char* name, unsigned long interval_ms, bool repeat, bool paused, const TaskStats& stats) for every live task
+    template<typename F>
+    void forEachTask(F fn) const {
+        for (TaskSlot i = 0; i < SCHEDULER_MAX_TASKS; ++i) {
+            const Slot& s = slots[i];
+            if (s.used && !s.cancelled)
+                fn(s.name, s.interval_ms, s.repeat, s.paused, s.stats);
         }
     }
 
 private:
-    struct SchedulerTask {
-        std::function<void()> callback;
-        unsigned long interval_ms;
-        unsigned long last_run;
-        bool repeat;
+    friend class TaskHandle;
+
+    static constexpr TaskSlot NONE = 0xFFFF;
+
+    struct Slot {
+        const char* name = "";
+        TaskCallback callback;
+        unsigned long interval_ms = 0;
+        unsigned long deadline = 0;
+        unsigned long seq = 0;
+        unsigned long pass = 0;
+        uint16_t generation = 0;
+        TaskSlot heapPos = NONE;
+        bool used = false;
+        bool repeat = false;
+        bool paused = false;
+        bool cancelled = false;
+        bool rescheduled = false;
+        TaskStats stats;
     };
 
-    std::vector<SchedulerTask> tasks;
+    Slot slots[SCHEDULER_MAX_TASKS];
+    TaskSlot heap[SCHEDULER_MAX_TASKS];
+    TaskSlot heapSize = 0;
+    TaskSlot freeSlots[SCHEDULER_MAX_TASKS];
+    TaskSlot freeCount = 0;
+    TaskSlot running = NONE;
+    unsigned long nextSeq = 0;
+    unsigned long passCount = 0;
+    LoopIdle idle;
+    Clock* clk = &SystemClock::instance();
+
+    static bool isDue(const Slot& s, unsigned long now) {
+        return (long)(now - s.deadline) >= 0;
+    }
+
+    // heap order: earliest deadline on top, FIFO between equal deadlines; wrap safe like the old now - last_run
+    bool before(TaskSlot a, TaskSlot b) const {
+        long diff = (long)(slots[a].deadline - slots[b].deadline);
+        if (diff != 0)
+            return diff < 0;
+        return (long)(slots[a].seq - slots[b].seq) < 0;
+    }
+
+    void place(TaskSlot pos, TaskSlot idx) {
+        heap[pos] = idx;
+        slots[idx].heapPos = pos;
+    }
+
+    void siftUp(TaskSlot pos) {
+        TaskSlot idx = heap[pos];
+        while (pos > 0) {
+            TaskSlot parent = (pos - 1) / 2;
+            if (!before(idx, heap[parent]))
+                break;
+            place(pos, heap[parent]);
+            pos = parent;
+        }
+        place(pos, idx);
+    }
+
+    void siftDown(TaskSlot pos) {
+        TaskSlot idx = heap[pos];
+        while (true) {
+            TaskSlot child = 2 * pos + 1;
+            if (child >= heapSize)
+                break;
+            if (child + 1 < heapSize && before(heap[child + 1], heap[child]))
+                child++;
+            if (!before(heap[child], idx))
+                break;
+            place(pos, heap[child]);
+            pos = child;
+        }
+        place(pos, idx);
+    }
+
+    void push(TaskSlot idx) {
+        slots[idx].seq = nextSeq++;
+        heap[heapSize] = idx;
+        siftUp(heapSize++);
+    }
+
+    void removeAt(TaskSlot pos) {
+        slots[heap[pos]].heapPos = NONE;
+        if (--heapSize == pos)
+            return;
+        TaskSlot moved = heap[heapSize];
+        place(pos, moved);
+        siftUp(pos);
+        siftDown(slots[moved].heapPos);
+    }
+
+    void release(TaskSlot idx) {
+        Slot& s = slots[idx];
+        s.callback = nullptr;
+        s.used = false;
+        s.generation++;
+        freeSlots[freeCount++] = idx;
+    }
+
+    Slot* resolve(const TaskHandle& h) {
+        if (h.slot >= SCHEDULER_MAX_TASKS)
+            return nullptr;
+        Slot& s = slots[h.slot];
+        if (!s.used || s.cancelled || s.generation != h.generation)
+            return nullptr;
+        return &s;
+    }
+
+    bool cancel(const TaskHandle& h) {
+        Slot* s = resolve(h);
+        if (!s) return false;
+        if (running == h.slot) {
+            s->cancelled = true;
+            return true;
+        }
+        if (s->heapPos != NONE)
+            removeAt(s->heapPos);
+        release(h.slot);
+        return true;
+    }
+
+    bool reschedule(const TaskHandle& h, unsigned long interval_ms) {
+        Slot* s = resolve(h);
+        if (!s) return false;
+        s->interval_ms = interval_ms;
+        s->deadline = clk->millis() + interval_ms;
+        if (running == h.slot) {
+            s->rescheduled = true;
+        } else if (s->heapPos != NONE) {
+            removeAt(s->heapPos);
+            push(h.slot);
+        }
+        idle.wake();
+        return true;
+    }
+
+    bool pause(const TaskHandle& h) {
+        Slot* s = resolve(h);
+        if (!s) return false;
+        s->paused = true;
+        if (s->heapPos != NONE)
+            removeAt(s->heapPos);
+        return true;
+    }
+
+    bool resume(const TaskHandle& h) {
+        Slot* s = resolve(h);
+        if (!s || !s->paused) return false;
+        s->paused = false;
+        if (running != h.slot) {
+            s->deadline = clk->millis() + s->interval_ms;
+            push(h.slot);
+        }
+        idle.wake();
+        return true;
+    }
 };
 
+inline bool TaskHandle::cancel() { return owner && owner->cancel(*this); }
+inline bool TaskHandle::reschedule(unsigned long interval_ms) { return owner && owner->reschedule(*this, interval_ms); }
+inline bool TaskHandle::pause() { return owner && owner->pause(*this); }
+inline bool TaskHandle::resume() { return owner && owner->resume(*this); }
+inline bool TaskHandle::active() const { return owner && owner->resolve(*this) != nullptr; }
+
 #endif
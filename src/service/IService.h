@@ -1,5 +1,8 @@
 #ifndef ISERVICE_H
 #define ISERVICE_H
+
+#include "ServiceId.h"
+
 /// @brief these are to be registered in a ServiceRegistry
 class IService {
 public:
@@ -9,5 +12,19 @@ public:
     virtual void update(unsigned long delta_ms) = 0;
     virtual unsigned long cycleTimeMs() const = 0;
     virtual const char* getTag() const = 0;
+    // services that must be ready() before start(), normally Dependencies::ids()
+    virtual ServiceIdList dependencies() const {
+        return ServiceIdList{nullptr, 0};
+    }
+};
+
+///@brief what a service derives from: dependencies() comes from its `typedef ServiceList<...> Dependencies`,
+/// so the list the registry starts by and the one addAll() checks cannot drift apart
+template<typename Derived>
+class ServiceBase : public IService {
+public:
+    ServiceIdList dependencies() const override {
+        return Derived::Dependencies::ids();
+    }
 };
 #endif
\ No newline at end of file
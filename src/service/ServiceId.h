@@ -0,0 +1,59 @@
+#ifndef SERVICE_ID_H
+#define SERVICE_ID_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+///@brief one registry slot per service type; a service names its slot with `static constexpr ServiceId ID`
+enum ServiceId : uint8_t {
+    SERVICE_EEPROM,
+    SERVICE_WIFI,
+    SERVICE_SDCARD,
+    SERVICE_WEBCOOKIE,
+    SERVICE_WEBSERVER,
+    SERVICE_SENSORLOG,
+    SERVICE_BOILERPLATE,
+    SERVICE_COUNT
+};
+
+struct ServiceIdList {
+    const ServiceId* ids;
+    size_t count;
+};
+
+///@brief compile time list of service types, used for dependencies and for the set main.cpp registers
+template<typename... Services>
+struct ServiceList {
+    static ServiceIdList ids() {
+        static constexpr ServiceId list[sizeof...(Services) + 1] = {Services::ID..., SERVICE_COUNT};
+        return ServiceIdList{list, sizeof...(Services)};
+    }
+
+    static constexpr bool contains(ServiceId id) {
+        return ((Services::ID == id) || ... || false);
+    }
+
+    // true if every type of this list is also in Set
+    template<typename Set>
+    static constexpr bool allIn() {
+        return (Set::contains(Services::ID) && ... && true);
+    }
+
+    // true if the Dependencies of every listed service are listed as well
+    static constexpr bool closed() {
+        return (Services::Dependencies::template allIn<ServiceList>() && ... && true);
+    }
+};
+
+class EEPROMService;
+class WiFiService;
+class SDCardService;
+class WebCookieService;
+class WebServerService;
+class SensorLoggingService;
+
+// the services main.cpp registers; ServiceRegistry::get<T>() of any other type does not compile
+typedef ServiceList<EEPROMService, WiFiService, SDCardService,
+                    WebCookieService, WebServerService, SensorLoggingService> CoreServices;
+
+#endif
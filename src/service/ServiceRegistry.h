@@ -1,45 +1,205 @@
 #ifndef SERVICE_REGISTRY_H
 #define SERVICE_REGISTRY_H
 
-#include <map>
-#include <string>
+#include <type_traits>
 #include <Arduino.h>
 
 #include "IService.h"
-///@brief creating servces ad-hoc is dangerous, they should be finite at start() and dependencies are to be start()ed in order 
+#include "ServiceId.h"
+
+///@brief timestamps of one service's boot, millis() since beginStartup()
+struct ServiceBoot {
+    const char* name;
+    const IService* service;
+    unsigned long startMs;
+    unsigned long readyMs;
+    bool started;
+    bool isReady;
+};
+
+///@brief creating servces ad-hoc is dangerous, they should be finite at start().
+/// Services are keyed by type: T::ID picks a fixed slot, so get<T>() is an array index plus a type check, no allocation.
+/// Start order is derived from IService::dependencies(): a service is start()ed once everything it names is ready(),
+/// services without a path between them start side by side.
 class ServiceRegistry {
 public:
-    IService*& operator[](const std::string& name) {
-        return services[name];
+    template<typename T>
+    void add(T& service) {
+        static_assert(std::is_base_of<IService, T>::value, "ServiceRegistry: not an IService");
+        static_assert(T::ID < SERVICE_COUNT, "ServiceRegistry: service ID out of range");
+        Slot& slot = slots[T::ID];
+        if (slot.service) {
+            Serial.print("Warning: Service '");
+            Serial.print(T::NAME);
+            Serial.println("' already registered. Ignoring.");
+            return;
+        }
+        slot.service = &service;
+        slot.type = typeTag<T>();
+        slot.boot = ServiceBoot{T::NAME, &service, 0, 0, false, false};
+    }
+
+    // registers a whole ServiceList at once; fails to compile if a listed service depends on one that is not listed
+    template<typename... Services>
+    void addAll(ServiceList<Services...>, Services&... services) {
+        static_assert(ServiceList<Services...>::closed(), "ServiceRegistry: a service depends on a service that is not registered");
+        (add(services), ...);
     }
 
-    const IService* operator[](const std::string& name) const {
-        auto it = services.find(name);
-        if (it != services.end()) {
-            return it->second;
+    // nullptr if T is not registered or its slot holds a different type
+    template<typename T>
+    T* get() const {
+        static_assert(T::ID < SERVICE_COUNT, "ServiceRegistry: service ID out of range");
+        static_assert(CoreServices::contains(T::ID), "ServiceRegistry: service is not in CoreServices, get() would always be nullptr");
+        const Slot& slot = slots[T::ID];
+        if (slot.type != typeTag<T>())
+            return nullptr;
+        return static_cast<T*>(slot.service);
+    }
+
+    // checks the dependency graph; false on unregistered dependencies or cycles, nothing is started then
+    bool beginStartup() {
+        bool ok = true;
+        for (size_t i = 0; i < SERVICE_COUNT; ++i) {
+            Slot& slot = slots[i];
+            if (!slot.service)
+                continue;
+            slot.boot.started = false;
+            slot.boot.isReady = false;
+            ServiceIdList deps = slot.service->dependencies();
+            for (size_t d = 0; d < deps.count; ++d) {
+                if (!slots[deps.ids[d]].service) {
+                    Serial.printf("ServiceRegistry: %s depends on an unregistered service (id %u)\n", slot.boot.name, (unsigned)deps.ids[d]);
+                    ok = false;
+                }
+            }
+        }
+        if (ok && hasCycle()) {
+            Serial.println("ServiceRegistry: dependency cycle, not starting services.");
+            ok = false;
         }
-        return nullptr;
+        startupValid = ok;
+        bootStart = millis();
+        bootDone = false;
+        return ok;
     }
 
-    void registerService(const std::string& name, IService* service) {
-        auto result = services.emplace(name, service);
-        if (!result.second) {
-            Serial.print("Warning: Service with name '");
-            Serial.print(name.c_str());
-            Serial.println("' already registered. Ignoring.");
+    // call from the loop until it returns true; onReady(IService*) runs once per service as it turns ready()
+    template<typename F>
+    bool updateStartup(F onReady) {
+        if (bootDone || !startupValid)
+            return bootDone;
+        bool allReady = true;
+        for (size_t i = 0; i < SERVICE_COUNT; ++i) {
+            Slot& slot = slots[i];
+            if (!slot.service || slot.boot.isReady)
+                continue;
+            if (slot.boot.started && slot.service->ready()) {
+                slot.boot.isReady = true;
+                slot.boot.readyMs = millis() - bootStart;
+                Serial.printf("%s: Service ready after %lu ms (boot +%lu ms).\n", slot.service->getTag(),
+                              slot.boot.readyMs - slot.boot.startMs, slot.boot.readyMs);
+                onReady(slot.service);
+                continue;
+            }
+            allReady = false;
+            if (!slot.boot.started && depsReady(*slot.service)) {
+                Serial.print(slot.service->getTag());
+                Serial.println(": Service starting...");
+                slot.boot.started = true;
+                slot.boot.startMs = millis() - bootStart;
+                slot.service->start();
+            }
+        }
+        if (allReady) {
+            bootDone = true;
+            Serial.printf("All services started in %lu ms.\n", bootTimeMs());
         }
+        return bootDone;
     }
 
-    template<typename T>
-    T* get(const std::string& name) const {
-        auto it = services.find(name);
-        if (it != services.end())
-            return static_cast<T*>(it->second);
-        return nullptr;
+    bool startupDone() const {
+        return bootDone;
+    }
+
+    // time until the last service turned ready, 0 while still booting
+    unsigned long bootTimeMs() const {
+        if (!bootDone)
+            return 0;
+        unsigned long last = 0;
+        for (const Slot& slot : slots)
+            if (slot.service && slot.boot.readyMs > last)
+                last = slot.boot.readyMs;
+        return last;
+    }
+
+    template<typename F>
+    void forEachBoot(F fn) const {
+        for (const Slot& slot : slots)
+            if (slot.service)
+                fn(slot.boot);
     }
 
 private:
-    std::map<std::string, IService*> services;
+    struct Slot {
+        IService* service = nullptr;
+        const void* type = nullptr;
+        ServiceBoot boot = {};
+    };
+
+    Slot slots[SERVICE_COUNT];
+    unsigned long bootStart = 0;
+    bool bootDone = false;
+    bool startupValid = false;
+
+    // one distinct address per type, stands in for RTTI which the esp32 core builds without
+    template<typename T>
+    static const void* typeTag() {
+        static const char tag = 0;
+        return &tag;
+    }
+
+    bool depsReady(const IService& service) const {
+        ServiceIdList deps = service.dependencies();
+        for (size_t d = 0; d < deps.count; ++d)
+            if (!slots[deps.ids[d]].boot.isReady)
+                return false;
+        return true;
+    }
+
+    // Kahn's algorithm over the slots, anything left over sits on a cycle
+    bool hasCycle() const {
+        uint8_t pending[SERVICE_COUNT] = {};
+        bool done[SERVICE_COUNT] = {};
+        size_t total = 0;
+        for (size_t i = 0; i < SERVICE_COUNT; ++i) {
+            if (!slots[i].service)
+                continue;
+            pending[i] = (uint8_t)slots[i].service->dependencies().count;
+            total++;
+        }
+        size_t resolved = 0;
+        bool progress = true;
+        while (progress) {
+            progress = false;
+            for (size_t i = 0; i < SERVICE_COUNT; ++i) {
+                if (!slots[i].service || done[i] || pending[i] > 0)
+                    continue;
+                done[i] = true;
+                resolved++;
+                progress = true;
+                for (size_t j = 0; j < SERVICE_COUNT; ++j) {
+                    if (!slots[j].service)
+                        continue;
+                    ServiceIdList deps = slots[j].service->dependencies();
+                    for (size_t d = 0; d < deps.count; ++d)
+                        if (deps.ids[d] == i)
+                            pending[j]--;
+                }
+            }
+        }
+        return resolved != total;
+    }
 };
 
 #endif
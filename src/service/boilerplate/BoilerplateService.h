@@ -7,8 +7,12 @@
 #include "../ServiceRegistry.h"
 #include "../eeprom/EEPROMService.h"
 
-class BoilerplateService : public IService {
+class BoilerplateService : public ServiceBase<BoilerplateService> {
 public:
+    static constexpr ServiceId ID = SERVICE_BOILERPLATE;
+    static constexpr const char* NAME = "BOILERPLATE";
+    typedef ServiceList<EEPROMService> Dependencies;
+
     BoilerplateService(ServiceRegistry& registry, const char* tag = "BoilerplateService") 
         : registry(registry), TAG(tag), isReady(false) {}
 
@@ -20,7 +24,7 @@ public:
         Serial.print(TAG);
         Serial.println(" started.");
 
-        EEPROMService* eeprom = registry.get<EEPROMService>("EEPROM");
+        EEPROMService* eeprom = registry.get<EEPROMService>();
         if (!eeprom) {
             Serial.println("EEPROMService not found in registry.");
             isReady = false;
@@ -10,9 +10,13 @@
 #include "../IService.h"
 #include "../ServiceRegistry.h"
 
-class EEPROMService : public IService {
+class EEPROMService : public ServiceBase<EEPROMService> {
 public:
-    EEPROMService(ServiceRegistry& registry, Scheduler& scheduler, const char* tag = "EEPROMService") 
+    static constexpr ServiceId ID = SERVICE_EEPROM;
+    static constexpr const char* NAME = "EEPROM";
+    typedef ServiceList<> Dependencies;
+
+    EEPROMService(ServiceRegistry& registry, Scheduler&, const char* tag = "EEPROMService") 
         : registry(registry), TAG(tag), eepromSize(512), nextFreeAddr(0), isReady(false) {}
 
     const char* getTag() const override {
@@ -31,7 +35,7 @@ public:
         isReady = true;
     }
 
-    void update(unsigned long delta_ms) override {
+    void update(unsigned long) override {
         delay(1); // still questionable but keeping your original code
     }
 
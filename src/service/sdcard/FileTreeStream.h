@@ -0,0 +1,159 @@
+#ifndef SDCARD_FILE_TREE_STREAM_H
+#define SDCARD_FILE_TREE_STREAM_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+
+#include "SDCardService.h"
+
+#define TREE_DEFAULT_DEPTH 1
+#define TREE_MAX_DEPTH 4  // directories held open at once, they share the card with the logger's files
+#define TREE_DEFAULT_LIMIT 100
+#define TREE_MAX_LIMIT 500
+#define TREE_LINE_SIZE 640  // one entry: a 255 character name with every character escaped, plus the keys
+#define TREE_MAX_STREAMS 2  // responses streaming at once, each holds a FileTreeStream
+
+// /api/tree/ document, written in pieces as the response asks for them:
+//   {"name":"logs","path":"/logs","type":"directory","children":[
+//     {"name":"20250714_00.bin","type":"file","size":5568},
+//     {"name":"old","type":"directory"},                        <- deeper than depth, fetch its path to list it
+//     {"name":"cfg","type":"directory","children":[...],"next":100},
+//     ...],"next":200}
+// Every directory lists at most limit children, in card order. "next" is present when it has more: the offset
+// to ask for with its path. The requested directory starts at offset, the ones below it at 0.
+
+///@brief lists a directory of the card depth levels deep as the JSON above, one entry per produce(). Only the
+/// directories on the way down are open, so memory is this object (under 1 KB) however many files there are, and
+/// a page costs offset + limit directory reads. Not thread safe, one response owns it.
+class FileTreeStream {
+public:
+    ~FileTreeStream() {
+        while (levels)
+            level[--levels].dir.close();
+    }
+
+    // false if path is not a directory
+    bool begin(SDCardService& card, const String& path, uint8_t maxDepth, uint32_t firstOffset, uint16_t pageLimit) {
+        File root = card.openFile(path, FILE_READ);
+        if (!root || !root.isDirectory())
+            return false;
+        depth = maxDepth < 1 ? 1 : maxDepth > TREE_MAX_DEPTH ? TREE_MAX_DEPTH : maxDepth;
+        limit = pageLimit < 1 ? 1 : pageLimit;
+
+        append("{\"name\":");
+        appendString(root.name());
+        append(",\"path\":");
+        appendString(path.c_str());
+        append(",\"type\":\"directory\",\"children\":[");
+        levels = 0;
+        push(root, firstOffset);
+        return true;
+    }
+
+    // the next bytes of the document into out, 0 once all of it was read
+    size_t read(uint8_t* out, size_t capacity) {
+        size_t written = 0;
+        while (written < capacity) {
+            if (lineSent == lineLength) {
+                lineLength = lineSent = 0;
+                if (!produce())
+                    break;
+                continue;
+            }
+            size_t n = lineLength - lineSent < capacity - written ? lineLength - lineSent : capacity - written;
+            memcpy(out + written, line + lineSent, n);
+            lineSent += n;
+            written += n;
+        }
+        return written;
+    }
+
+private:
+    struct Level {
+        File dir;
+        uint32_t skipped;  // this page's offset, so next can be given
+        uint16_t listed;
+    };
+
+    uint8_t depth = TREE_DEFAULT_DEPTH;
+    uint16_t limit = TREE_DEFAULT_LIMIT;
+    Level level[TREE_MAX_DEPTH];
+    uint8_t levels = 0;  // open directories, level[levels - 1] is being listed
+    char line[TREE_LINE_SIZE];
+    size_t lineLength = 0;
+    size_t lineSent = 0;
+
+    Level& levelAt() {
+        return level[levels - 1];
+    }
+
+    void push(File dir, uint32_t skip) {
+        Level& l = level[levels++];
+        l.dir = dir;
+        l.skipped = 0;
+        l.listed = 0;
+        // nothing but the directory reads to find the page
+        while (l.skipped < skip) {
+            File entry = l.dir.openNextFile();
+            if (!entry)
+                break;
+            entry.close();
+            l.skipped++;
+        }
+    }
+
+    void append(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(line + lineLength, sizeof(line) - lineLength, format, args);
+        va_end(args);
+        if (n > 0)
+            lineLength = lineLength + n < sizeof(line) ? lineLength + n : sizeof(line) - 1;
+    }
+
+    // a JSON string; FAT names have no quotes or backslashes, other cards' names might, control characters become ?
+    void appendString(const char* s) {
+        if (lineLength < sizeof(line) - 1)
+            line[lineLength++] = '"';
+        for (; *s && lineLength < sizeof(line) - 3; ++s) {
+            if (*s == '"' || *s == '\\')
+                line[lineLength++] = '\\';
+            line[lineLength++] = (unsigned char)*s < 0x20 ? '?' : *s;
+        }
+        line[lineLength++] = '"';
+    }
+
+    // the next entry, or the end of the directory being listed, into line. False after the last one
+    bool produce() {
+        if (levels == 0)
+            return false;
+        Level& l = levelAt();
+        File entry = l.dir.openNextFile();
+        if (!entry || l.listed == limit) {
+            bool more = (bool)entry;
+            uint32_t next = l.skipped + l.listed;
+            if (entry)
+                entry.close();
+            l.dir.close();
+            levels--;
+            append(more ? "],\"next\":%lu}" : "]}", (unsigned long)next);
+            return true;
+        }
+
+        append(l.listed++ ? ",{\"name\":" : "{\"name\":");
+        appendString(entry.name());
+        if (!entry.isDirectory()) {
+            append(",\"type\":\"file\",\"size\":%lu}", (unsigned long)entry.size());
+            entry.close();
+        } else if (levels < depth) {
+            append(",\"type\":\"directory\",\"children\":[");
+            push(entry, 0);
+        } else {
+            append(",\"type\":\"directory\"}");
+            entry.close();
+        }
+        return true;
+    }
+};
+
+#endif
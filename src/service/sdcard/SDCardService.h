@@ -8,8 +8,19 @@
 #include "../IService.h"
 #include "../ServiceRegistry.h"
 
-class SDCardService : public IService {
+// files open on the card at once, the VFS refuses the next one (SD.begin's default is 5): the logger's file and
+// the rollup or index file it appends to, a log and its index per /api/series query, plus downloads, the
+// editor and the cookie store. Directories do not count. Each open file takes a sector buffer from the heap
+#ifndef SD_MAX_OPEN_FILES
+#define SD_MAX_OPEN_FILES 12
+#endif
+
+class SDCardService : public ServiceBase<SDCardService> {
 public:
+    static constexpr ServiceId ID = SERVICE_SDCARD;
+    static constexpr const char* NAME = "SDCARD";
+    typedef ServiceList<> Dependencies;
+
     SDCardService(ServiceRegistry& registry, Scheduler& scheduler, const char* tag = "SDCardService")
         : registry(registry), scheduler(scheduler), TAG(tag), isReady(false) {}
 
@@ -23,7 +34,7 @@ public:
 
         SPI.begin();
 
-        if (!SD.begin(CS)) {
+        if (!SD.begin(CS, SPI, SD_FREQUENCY, "/sd", SD_MAX_OPEN_FILES)) {
             Serial.println(TAG);
             Serial.println(": SD card initialization failed!");
             isReady = false;
@@ -70,7 +81,7 @@ public:
         isReady = true;
     }
 
-    void update(unsigned long delta_ms) override {
+    void update(unsigned long) override {
         // noop
     }
 
@@ -168,7 +179,7 @@ public:
         return SD.rmdir(path);
     }
 
-    bool listDir(const String& path, String& outList, int depth = 1) {
+    bool listDir(const String& path, String& outList, [[maybe_unused]] int depth = 1) {
         File root = SD.open(path);
         if (!root || !root.isDirectory()) return false;
 
@@ -181,35 +192,6 @@ public:
         return true;
     }
     
-    void buildFileTree(JsonObject &out) {
-        File root = SD.open("/");
-        if (!root || !root.isDirectory()) {
-            out["error"] = "Failed to open SD root";
-            return;
-        }
-        buildTreeRecursive(root, out);
-        root.close();
-    }
-
-    void buildTreeRecursive(File dir, JsonObject &node) {
-        node["name"] = String(dir.name());
-        node["type"] = "directory";
-        JsonArray children = node.createNestedArray("children");
-
-        File entry = dir.openNextFile();
-        while (entry) {
-            JsonObject child = children.createNestedObject();
-            if (entry.isDirectory()) {
-            buildTreeRecursive(entry, child);
-            } else {
-            child["name"] = String(entry.name());
-            child["type"] = "file";
-            }
-            entry.close();
-            entry = dir.openNextFile();
-        }
-    }
-
     uint64_t getUsedSpace() {
         File root = SD.open("/");
         if (!root) return 0;
@@ -246,6 +228,7 @@ private:
     bool isReady;
 
     static constexpr uint8_t CS = 18;
+    static constexpr uint32_t SD_FREQUENCY = 4000000;  // SD.begin's default
     static constexpr uint8_t MOSI = 19;
     static constexpr uint8_t MISO = 20;
     static constexpr uint8_t SCK = 21;
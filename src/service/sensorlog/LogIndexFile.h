@@ -0,0 +1,80 @@
+#ifndef SENSORLOG_LOG_INDEX_FILE_H
+#define SENSORLOG_LOG_INDEX_FILE_H
+
+#include <Arduino.h>
+
+#include "../sdcard/SDCardService.h"
+#include "../../pipeline/sample_log_reader.h"
+
+#define LOG_INDEX_DIR "/logs/" SAMPLE_INDEX_DIR
+#define LOG_INDEX_PENDING 16  // entries, a block each; written after the log commits the blocks they point to
+
+///@brief appends one (first timestamp, offset) entry per block to the open log's sidecar index.
+/// Entries wait in RAM until the blocks they name are on the card, a crash can lose index tail but never
+/// leave an entry pointing past the end of the log; SampleLogReader scans on from the last entry it has.
+/// An index that does not open keeps its entries for the next flush; only once LOG_INDEX_PENDING wait are
+/// further blocks left out, which costs a reader a longer scan, not a sample.
+class LogIndexFile {
+public:
+    void begin(SDCardService& card) {
+        sd = &card;
+        if (!sd->fileExists(LOG_INDEX_DIR))
+            sd->createDir(LOG_INDEX_DIR);
+    }
+
+    // the index of logPath from now on; fresh means the log was just created, so an index left over from an
+    // earlier file of that name is dropped
+    void open(const String& logPath, bool fresh) {
+        pending = 0;
+        if (!sample_index::indexPath(logPath.c_str(), path, sizeof(path))) {
+            path[0] = '\0';
+            return;
+        }
+        if (fresh && sd->fileExists(path))
+            sd->removeFile(path);
+    }
+
+    // false once LOG_INDEX_PENDING entries wait: commit the log, then flush()
+    bool add(uint32_t firstTimestamp, uint32_t offset) {
+        if (pending == LOG_INDEX_PENDING) {
+            skipped++;  // the last flushes failed, this block goes without an entry
+            return false;
+        }
+        sample_index::encodeEntry(firstTimestamp, offset, entries + pending * SAMPLE_INDEX_ENTRY);
+        return ++pending < LOG_INDEX_PENDING;
+    }
+
+    // only after the log committed every block added so far; false if the index did not open
+    bool flush() {
+        if (pending == 0 || path[0] == '\0')
+            return true;
+        File file = sd->openFile(path, FILE_APPEND);
+        if (!file) {
+            Serial.printf("LogIndexFile: Failed to open %s, %u entries kept for the next flush\n", path,
+                          (unsigned)pending);
+            return false;
+        }
+        if (file.size() == 0) {
+            uint8_t header[SAMPLE_INDEX_HEADER];
+            file.write(header, sample_index::encodeHeader(header));
+        }
+        file.write(entries, pending * SAMPLE_INDEX_ENTRY);
+        file.close();
+        pending = 0;
+        return true;
+    }
+
+    // blocks that got no entry because the index could not be written for LOG_INDEX_PENDING of them
+    uint32_t skippedEntries() const {
+        return skipped;
+    }
+
+private:
+    SDCardService* sd = nullptr;
+    char path[40] = {0};
+    uint8_t entries[LOG_INDEX_PENDING * SAMPLE_INDEX_ENTRY];
+    uint8_t pending = 0;
+    uint32_t skipped = 0;
+};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef SENSORLOG_LOG_ROTATION_H
+#define SENSORLOG_LOG_ROTATION_H
+
+#include <Arduino.h>
+#include <time.h>
+
+#include "../sdcard/SDCardService.h"
+#include "../../pipeline/sample_log.h"
+
+#define LOG_HOUR_FORMAT "/logs/%Y%m%d_%H"
+
+///@brief which /logs/YYYYMMDD_HH[_N].bin a sample goes to. The hour window and file index live in RAM,
+/// so the card is only probed when the hour changes or the open file reaches maxSize.
+class LogRotation {
+public:
+    explicit LogRotation(size_t maxSize) : maxSize(maxSize) {}
+
+    // true when a sample taken at now no longer belongs in the open file of fileSize bytes
+    bool due(time_t now, size_t fileSize) const {
+        return now < hourStart || now >= hourEnd || fileSize >= maxSize;
+    }
+
+    // path for the sample at now: a new hour starts at index 0, a full file moves on to the next index;
+    // existing files that are already full (from before a reboot) are skipped
+    String next(SDCardService& sd, time_t now) {
+        if (now < hourStart || now >= hourEnd)
+            enterHour(now);
+        else
+            index++;
+
+        while (true) {
+            String path = filePath(index);
+            if (!sd.fileExists(path))
+                return path;
+            File probe = sd.openFile(path, FILE_READ);
+            size_t size = probe.size();
+            probe.close();
+            if (size < maxSize)
+                return path;
+            index++;
+        }
+    }
+
+    // the log at index of the local hour holding t, for readers
+    static String pathFor(time_t t, int index) {
+        struct tm tmInfo;
+        char hour[24];
+        localtime_r(&t, &tmInfo);
+        strftime(hour, sizeof(hour), LOG_HOUR_FORMAT, &tmInfo);
+        String path = hour;
+        if (index > 0)
+            path += "_" + String(index);
+        path += SAMPLE_LOG_EXT;
+        return path;
+    }
+
+private:
+    size_t maxSize;
+    char base[24] = {0};  // "/logs/YYYYMMDD_HH"
+    time_t hourStart = 0;
+    time_t hourEnd = 0;
+    int index = 0;
+
+    // local hour boundaries, so DST and half hour zones split files where the name changes
+    void enterHour(time_t now) {
+        struct tm tmInfo;
+        localtime_r(&now, &tmInfo);
+        strftime(base, sizeof(base), LOG_HOUR_FORMAT, &tmInfo);
+        hourStart = now - tmInfo.tm_min * 60 - tmInfo.tm_sec;
+        hourEnd = hourStart + 3600;
+        index = 0;
+    }
+
+    String filePath(int i) const {
+        String path = base;
+        if (i > 0)
+            path += "_" + String(i);
+        path += SAMPLE_LOG_EXT;
+        return path;
+    }
+};
+
+#endif
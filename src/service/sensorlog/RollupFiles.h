@@ -0,0 +1,217 @@
+#ifndef SENSORLOG_ROLLUP_FILES_H
+#define SENSORLOG_ROLLUP_FILES_H
+
+#include <Arduino.h>
+#include <time.h>
+
+#include "../sdcard/SDCardService.h"
+#include "../../pipeline/rollup.h"
+#include "../../pipeline/sample_log.h"
+
+#define ROLLUP_DIR "/logs/rollup"
+#define ROLLUP_PENDING_RECORDS 8  // per tier, written on the raw log's commits or when full
+
+enum class FileSpan : uint8_t { Hour, Day, Year };
+
+struct RollupTierSpec {
+    uint32_t seconds;
+    const char* pathFormat;  // strftime of the bucket start in local time, one file per span
+    FileSpan span;
+};
+
+static constexpr RollupTierSpec ROLLUP_TIERS[] = {
+    {1, ROLLUP_DIR "/%Y%m%d_%H_1s.bin", FileSpan::Hour},
+    {60, ROLLUP_DIR "/%Y%m%d_1m.bin", FileSpan::Day},
+    {3600, ROLLUP_DIR "/%Y_1h.bin", FileSpan::Year},
+};
+static constexpr size_t ROLLUP_TIER_COUNT = sizeof(ROLLUP_TIERS) / sizeof(ROLLUP_TIERS[0]);
+
+// the tier's file for the span holding t; index > 0 names the files that follow one with another header,
+// "_N" before the extension like the raw logs
+inline void rollupPath(size_t tier, time_t t, int index, char* out, size_t outSize) {
+    struct tm tmInfo;
+    localtime_r(&t, &tmInfo);
+    size_t n = strftime(out, outSize, ROLLUP_TIERS[tier].pathFormat, &tmInfo);
+    size_t ext = sizeof(SAMPLE_LOG_EXT) - 1;
+    if (index > 0 && n > ext)
+        snprintf(out + n - ext, outSize - (n - ext), "_%d" SAMPLE_LOG_EXT, index);
+}
+
+// start of the local hour / day / year after the one holding t, where readers move on to the next file
+inline time_t fileSpanEnd(time_t t, FileSpan span) {
+    struct tm tmInfo;
+    localtime_r(&t, &tmInfo);
+    tmInfo.tm_sec = 0;
+    tmInfo.tm_min = 0;
+    if (span == FileSpan::Hour) {
+        tmInfo.tm_hour++;
+    } else {
+        tmInfo.tm_hour = 0;
+        if (span == FileSpan::Day) {
+            tmInfo.tm_mday++;
+        } else {
+            tmInfo.tm_mday = 1;
+            tmInfo.tm_mon = 0;
+            tmInfo.tm_year++;
+        }
+    }
+    tmInfo.tm_isdst = -1;
+    return mktime(&tmInfo);
+}
+
+///@brief keeps the 1 s / 1 min / 1 h rollups next to the raw log so charts over days read a few kilobytes.
+/// Every sample folds into each tier in O(1); closed buckets wait in RAM and reach the card in small appends.
+class RollupFiles {
+public:
+    // tiers whose bucket is not longer than the sample period would only repeat the raw log and stay off
+    void begin(SDCardService& card, const SampleLogHeader& rawHeader) {
+        sd = &card;
+        if (!sd->fileExists(ROLLUP_DIR))
+            sd->createDir(ROLLUP_DIR);
+        for (size_t i = 0; i < ROLLUP_TIER_COUNT; ++i) {
+            Tier& t = tiers[i];
+            t.enabled = ROLLUP_TIERS[i].seconds * 1000 > rawHeader.samplePeriodMs;
+            t.rollup.begin(ROLLUP_TIERS[i].seconds);
+            t.header = rawHeader;
+            t.header.rollup = true;
+            t.header.version = SAMPLE_LOG_VERSION;
+            t.header.recordSize = t.header.expectedRecordSize();
+            t.header.samplePeriodMs = ROLLUP_TIERS[i].seconds * 1000;
+            // buckets fold in every sample, the deadband only thins out the raw log
+            for (uint8_t c = 0; c < t.header.channelCount; ++c) {
+                t.header.channels[c].deadband = 0;
+                t.header.channels[c].heartbeatSeconds = 0;
+            }
+            t.pending = 0;
+            t.spanStart = t.spanEnd = 0;
+            t.path[0] = '\0';
+        }
+    }
+
+    void add(const SensorSample& sample) {
+        for (size_t i = 0; i < ROLLUP_TIER_COUNT; ++i) {
+            RollupBucket closed;
+            if (tiers[i].enabled && tiers[i].rollup.add(sample, closed))
+                queue(i, closed);
+        }
+    }
+
+    // closed buckets to the card, called when the raw log commits so both are equally durable. A file that
+    // does not open keeps its records pending for the next flush
+    void flush() {
+        for (size_t i = 0; i < ROLLUP_TIER_COUNT; ++i)
+            write(i);
+    }
+
+    // shutdown: the open buckets are written too, as far as they got
+    void close() {
+        for (size_t i = 0; i < ROLLUP_TIER_COUNT; ++i) {
+            RollupBucket partial;
+            if (tiers[i].enabled && tiers[i].rollup.takePartial(partial))
+                queue(i, partial);
+        }
+        flush();
+    }
+
+    uint32_t recordsWritten() const {
+        return written;
+    }
+
+    // records that found their tier's pending buffer full, or their span over, while the card refused them
+    uint32_t recordsDropped() const {
+        return dropped;
+    }
+
+private:
+    struct Tier {
+        bool enabled = false;
+        RollupTier rollup;
+        SampleLogHeader header;
+        uint8_t records[ROLLUP_PENDING_RECORDS * ROLLUP_RECORD_SIZE];
+        uint8_t pending = 0;
+        time_t spanStart;  // first bucket of the span the pending records belong to, and where that span ends
+        time_t spanEnd;
+        char path[40];     // their file, empty until the card was asked which index of the span to append to
+    };
+
+    SDCardService* sd = nullptr;
+    Tier tiers[ROLLUP_TIER_COUNT];
+    uint32_t written = 0;
+    uint32_t dropped = 0;
+
+    void queue(size_t i, const RollupBucket& bucket) {
+        Tier& t = tiers[i];
+        time_t start = bucket.start;
+        if (start < t.spanStart || start >= t.spanEnd) {
+            if (!write(i)) {
+                // the next records go to another file, these have nowhere to wait
+                dropped += t.pending;
+                t.pending = 0;
+            }
+            t.spanStart = start;
+            t.spanEnd = fileSpanEnd(start, ROLLUP_TIERS[i].span);
+            t.path[0] = '\0';
+        }
+        if (t.pending == ROLLUP_PENDING_RECORDS) {
+            dropped++;  // still full, the card took none of them
+            return;
+        }
+        bucket.encode(t.records + t.pending * ROLLUP_RECORD_SIZE);
+        if (++t.pending == ROLLUP_PENDING_RECORDS)
+            write(i);
+    }
+
+    // true if records of t can be appended to the file at path: it is new, empty, or a rollup of the same
+    // channels and bucket length, as SensorLoggingService::appendable() asks of the raw logs
+    bool appendable(const Tier& t, const char* path) {
+        if (!sd->fileExists(path))
+            return true;
+        File file = sd->openFile(path, FILE_READ);
+        uint8_t buffer[SAMPLE_LOG_MAX_HEADER];
+        size_t length = file.read(buffer, sizeof(buffer));
+        file.close();
+        SampleLogHeader existing;
+        return length == 0 || (SampleLogDecoder::decodeHeader(buffer, length, existing) > 0 && existing.rollup &&
+                               existing.samplePeriodMs == t.header.samplePeriodMs &&
+                               existing.recordSize == t.header.recordSize && existing.sameChannels(t.header));
+    }
+
+    // the span's first file that takes this tier's records; a file of that span left by older firmware or
+    // another configuration stays as it is
+    void choosePath(size_t i) {
+        Tier& t = tiers[i];
+        for (int index = 0;; ++index) {
+            rollupPath(i, t.spanStart, index, t.path, sizeof(t.path));
+            if (appendable(t, t.path))
+                return;
+            Serial.printf("RollupFiles: %s has another format, skipping it\n", t.path);
+        }
+    }
+
+    // false if the file did not open, the records stay pending
+    bool write(size_t i) {
+        Tier& t = tiers[i];
+        if (t.pending == 0)
+            return true;
+        if (t.path[0] == '\0')
+            choosePath(i);
+        File file = sd->openFile(t.path, FILE_APPEND);
+        if (!file) {
+            Serial.printf("RollupFiles: Failed to open %s, %u records kept for the next flush\n", t.path,
+                          (unsigned)t.pending);
+            return false;
+        }
+        if (file.size() == 0) {
+            uint8_t header[SAMPLE_LOG_MAX_HEADER];
+            t.header.createdUnix = sample_log::get32(t.records);
+            file.write(header, SampleLogEncoder::encodeHeader(t.header, header, sizeof(header)));
+        }
+        file.write(t.records, t.pending * ROLLUP_RECORD_SIZE);
+        file.close();
+        written += t.pending;
+        t.pending = 0;
+        return true;
+    }
+};
+
+#endif
@@ -3,65 +3,156 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include <atomic>
+#include <esp_system.h>
 #include "../IService.h"
 #include "../ServiceRegistry.h"
 #include "../sdcard/SDCardService.h"
 #include "../wifi/WiFiService.h"
+#include "LogIndexFile.h"
+#include "LogRotation.h"
+#include "RollupFiles.h"
+#include "../../adc/adc_source.h"
+#include "../../adc/continuous_adc_source.h"
+#include "../../adc/host_adc_source.h"
+#include "../../pipeline/deadband.h"
+#include "../../pipeline/group_commit.h"
+#include "../../pipeline/live_feed.h"
+#include "../../pipeline/retained_ring.h"
+#include "../../pipeline/sample_codec.h"
+#include "../../pipeline/sample_log.h"
+#include "../../pipeline/sample_pipeline.h"
 
+#ifndef MAX_FILE_SIZE
 #define MAX_FILE_SIZE (20 * 1024 * 1024)  // 20MB
+#endif
 
-constexpr uint8_t PIN_ADC4 = 4;  // ADC1_CH4
-constexpr uint8_t PIN_ADC5 = 5;  // ADC1_CH5
-constexpr uint8_t PIN_ADC6 = 6;  // ADC1_CH6
+// defined in main.cpp, RTC_NOINIT on the ESP32 so it outlives a soft reset
+extern RetainedRingStore retainedSamples;
 
-class SensorLoggingService : public IService {
+class SensorLoggingService : public ServiceBase<SensorLoggingService> {
 public:
+    static constexpr ServiceId ID = SERVICE_SENSORLOG;
+    static constexpr const char* NAME = "SENSORLOG";
+    // the card is not a dependency either: samples wait in the retained ring until it is ready
+    typedef ServiceList<> Dependencies;
+
     SensorLoggingService(ServiceRegistry& registry, Scheduler& scheduler, const char* tag = "SensorLoggingService")
-        : registry(registry), scheduler(scheduler), TAG(tag), isReady(false) {}
+        : TAG(tag), registry(registry), scheduler(scheduler), isReady(false), retained(retainedSamples),
+          rotation(MAX_FILE_SIZE) {}
 
     void start() override {
-        sd = registry.get<SDCardService>("SDCARD");
-        wifi = registry.get<WiFiService>("WIFI");
+        sd = registry.get<SDCardService>();
+        wifi = registry.get<WiFiService>();
 
-        if (!sd || !sd->ready() || !wifi || !wifi->ready()) {
+        // WiFi is not a dependency so sampling starts without waiting for the connection; samples taken
+        // before NTP sync carry the uptime and are logged as a session of their own, see writeSample()
+        if (!sd || !wifi) {
             Serial.println("SensorLoggingService: Required services not available.");
             return;
         }
 
-        ensureLogDir();
+        // whatever the last run sampled after its last commit is written ahead of the first new batch
+        if (retained.recover())
+            Serial.printf("SensorLoggingService: Retained samples since %lu kept for replay\n",
+                          (unsigned long)retained.committedTimestamp());
+        replayPending = true;
+
+        logHeader = SampleLogHeader();
+        SampleLogEncoder::describeChannels(logHeader);
+        logHeader.samplePeriodMs = adcConfig.outputPeriodMs;
+        logHeader.version = SAMPLE_LOG_VERSION_BLOCKS;
+
+        // the ADC converts all channels continuously, the sampler averages each output period down to one sample
+#ifndef ESP_PLATFORM
+        adcSource.useClock(scheduler.clock());
+#endif
+        if (!adcSource.begin(SENSOR_CHANNELS, SENSOR_CHANNEL_COUNT, adcConfig)) {
+            Serial.println("SensorLoggingService: Failed to start continuous ADC.");
+            return;
+        }
+        decimator.begin(adcSource, SENSOR_CHANNEL_COUNT, adcConfig);
+        PipelineConfig pipelineConfig;
+        pipelineConfig.samplePeriodMs = adcConfig.pollPeriodMs;
+
+        // sampler on core 1 next to loop(), SD writes on core 0 so a slow card never delays draining the ADC
+        SamplePipeline::SampleFn sampler = [this](SensorSample& sample) { return readSensors(sample); };
+        SamplePipeline::WriteFn writer = [this](const SensorSample* batch, size_t count) { writeBatch(batch, count); };
+        if (!scheduler.clock().realTime()) {
+            // simulated time: no task may sleep on its own, so sample and write from the scheduler
+            pipeline.begin(sampler, writer, pipelineConfig);
+            scheduler.addTask("sensorlog", [this]() { pipeline.pump(); }, pipelineConfig.samplePeriodMs, true);
+        } else if (!pipeline.start(sampler, writer, pipelineConfig)) {
+            Serial.println("SensorLoggingService: Failed to start sampling pipeline.");
+            return;
+        }
+
+        // ESP.restart() from the web UI or the WiFi fallback commits the buffered tail first
+        if (!shutdownTarget) {
+            shutdownTarget = this;
+            esp_register_shutdown_handler(&SensorLoggingService::onShutdown);
+        }
+
         isReady = true;
         Serial.println("SensorLoggingService: Started.");
     }
 
+    // stops sampling and commits everything still buffered, the log stays consistent for the next boot
+    void shutdown() {
+        pipeline.stop();
+        adcSource.end();
+        // the last sample the deadband skipped: without it a reader could not tell its values lasted until now
+        if (heldPending && currentFile)
+            logSample(heldSample, scheduler.clock().millis());
+        closeBlock();
+        if (logWriter.detach(scheduler.clock().millis()))
+            committed();
+        else
+            commitFailed();
+        if (currentFile)
+            currentFile.close();
+        currentPath = String();
+        rollups.close();
+    }
+
     void update(unsigned long) override {
-        if (!isReady) return;
+        // sampling and writing run on their own tasks
+    }
 
-        switch (state) {
-            case READ_ADC4:
-                valueADC4 = analogRead(PIN_ADC4);
-                state = READ_ADC5;
-                break;
+    PipelineStats pipelineStats() const {
+        return pipeline.stats();
+    }
 
-            case READ_ADC5:
-                valueADC5 = analogRead(PIN_ADC5);
-                state = READ_ADC6;
-                break;
+    GroupCommitStats writerStats() const {
+        return logWriter.stats();
+    }
 
-            case READ_ADC6:
-                valueADC6 = analogRead(PIN_ADC6);
-                state = LOG_ALL;
-                break;
+    const CommitPolicy& commitPolicy() const {
+        return logWriter.getPolicy();
+    }
 
-            case LOG_ALL:
-                logSensors();
-                state = READ_ADC4;
-                break;
-        }
+    uint32_t samplePeriodMs() const {
+        return adcConfig.outputPeriodMs;
+    }
+
+    // every sample as it is taken, for /api/live; subscribers read it on their own, never from the card
+    const LiveFeed& liveFeed() const {
+        return live;
+    }
+
+    // samples a previous run or a missing card left in the retained ring that were logged late
+    uint32_t replayedSamples() const {
+        return replayed;
+    }
+
+    // samples taken before the clock was set, logged under the uptime clock
+    uint32_t unsyncedSamples() const {
+        return unsynced;
     }
 
     const char* getTag() const override { return TAG; }
     bool ready() const override { return isReady; }
-    unsigned long cycleTimeMs() const override { return 333; }
+    unsigned long cycleTimeMs() const override { return 0; }
 
 private:
     const char* TAG;
@@ -73,75 +164,277 @@ private:
 
     File currentFile;
     String currentPath;
+    SampleLogHeader logHeader;
+    GroupCommitWriter<File> logWriter;
+    SampleBlockEncoder blockEncoder;
+    unsigned long blockOpenedMs = 0;
+    uint8_t blockBuffer[SAMPLE_BLOCK_MAX_SIZE];
+    uint32_t lastAddedTimestamp = 0;
+    uint32_t appendedTimestamp = 0;  // newest sample the group commit buffer or the card accounts for
+    std::atomic<uint32_t> sessionFrom{0};  // first sample this boot took on the synced clock, set by the sampler task
+    bool sessionLogged = false;
+    bool uptimeSessionLogged = false;
+    SensorSample heldSample = {};  // newest sample the deadband skipped since the last logged one
+    bool heldPending = false;
+    RetainedSampleRing retained;
+    bool cardOpen = false;
+    bool replayPending = false;
+    uint32_t replayed = 0;
+    uint32_t unsynced = 0;
+    LogRotation rotation;
+    RollupFiles rollups;
+    LogIndexFile logIndex;
+    DeadbandFilter deadband;
+    LiveFeed live;
 
-    enum State { READ_ADC4, READ_ADC5, READ_ADC6, LOG_ALL };
-    State state = READ_ADC4;
+    SamplePipeline pipeline;
+    AdcConfig adcConfig;
+    AdcDecimator decimator;
+#ifdef ESP_PLATFORM
+    ContinuousAdcSource adcSource;
+#else
+    HostAdcSource adcSource;
+#endif
 
-    int valueADC4 = 0;
-    int valueADC5 = 0;
-    int valueADC6 = 0;
+    static inline SensorLoggingService* shutdownTarget = nullptr;
 
-    void ensureLogDir() {
-        if (!sd->fileExists("/logs")) {
-            sd->createDir("/logs");
-        }
+    static void onShutdown() {
+        shutdownTarget->shutdown();
     }
 
-    String getLogFilePath(time_t now) {
-        struct tm* tmInfo = localtime(&now);
+    // "logging": {"commitSamples": 45, "durabilityMs": 60000,
+    //             "channels": {"ADC4": {"deadband": 24, "heartbeatS": 900}}} in /config.json, defaults otherwise.
+    // A deadband of 0 logs every sample of that channel, and with it every sample
+    void loadConfig() {
+        CommitPolicy policy;
+        File file = sd->openFile("/config.json", FILE_READ);
+        if (file) {
+            DynamicJsonDocument cfg(2048);
+            if (!deserializeJson(cfg, file)) {
+                policy.maxSamples = cfg["logging"]["commitSamples"] | policy.maxSamples;
+                policy.durabilityMs = cfg["logging"]["durabilityMs"] | policy.durabilityMs;
+                for (uint8_t i = 0; i < logHeader.channelCount; ++i) {
+                    SampleLogChannel& c = logHeader.channels[i];
+                    JsonVariant channel = cfg["logging"]["channels"][(const char*)c.name];
+                    c.deadband = channel["deadband"] | c.deadband;
+                    uint16_t heartbeat = channel["heartbeatS"] | c.heartbeatSeconds;
+                    if (heartbeat > 0)
+                        c.heartbeatSeconds = heartbeat;
+                }
+            }
+            file.close();
+        }
+        logWriter.setPolicy(policy);
+        Serial.printf("SensorLoggingService: Commit every %u samples or %lu ms\n",
+                      (unsigned)policy.maxSamples, (unsigned long)policy.durabilityMs);
+        if (logHeader.deadbanded())
+            Serial.printf("SensorLoggingService: Logging on change, heartbeat %lu s\n",
+                          (unsigned long)logHeader.heartbeatSeconds());
+    }
 
-        char timeStr[32];
-        strftime(timeStr, sizeof(timeStr), "/logs/%Y%m%d_%H", tmInfo);
+    // writer task, once the card is ready: everything that needs it besides the log file itself
+    void openCard() {
+        ensureLogDir();
+        loadConfig();
+        deadband.begin(logHeader);
+        blockEncoder.begin(logHeader.channelCount, logWriter.getPolicy().maxSamples);
+        rollups.begin(*sd, logHeader);
+        logIndex.begin(*sd);
+        cardOpen = true;
+    }
 
-        int index = 0;
-        String base = String(timeStr);
+    // after every commit of the log: its index and the retained ring catch up
+    void committed() {
+        logIndex.flush();
+        if (appendedTimestamp)
+            retained.commit(appendedTimestamp);
+    }
 
-        while (true) {
-            String path = base;
-            if (index > 0) {
-                path += "_" + String(index);
-            }
-            path += ".json";
+    // the card did not take all of a commit: the index and the retained ring stay where they are, so the samples
+    // are replayed after a reboot, and the next commit retries what is still buffered
+    void commitFailed() {
+        Serial.printf("SensorLoggingService: Commit to %s failed, %u bytes still buffered\n", currentPath.c_str(),
+                      (unsigned)logWriter.stats().buffered);
+    }
 
-            if (!sd->fileExists(path) || sd->openFile(path, FILE_READ).size() < MAX_FILE_SIZE) {
-                return path;
-            }
-            index++;
+    void ensureLogDir() {
+        if (!sd->fileExists("/logs")) {
+            sd->createDir("/logs");
         }
     }
 
-    void rotateFile(const String& newPath) {
+    // true if samples can be appended to the log at path: it is new, empty, or a block log of our channels,
+    // logged with the same deadbands
+    bool appendable(const String& path) {
+        if (!sd->fileExists(path))
+            return true;
+        File file = sd->openFile(path, FILE_READ);
+        uint8_t buffer[SAMPLE_LOG_MAX_HEADER];
+        size_t length = file.read(buffer, sizeof(buffer));
+        file.close();
+        SampleLogHeader existing;
+        return length == 0 || (SampleLogDecoder::decodeHeader(buffer, length, existing) > 0 && existing.blocks() &&
+                               !existing.rollup && existing.sameChannels(logHeader));
+    }
+
+    void rotateFile(const String& newPath, time_t now) {
+        closeBlock();
+        if (logWriter.detach(scheduler.clock().millis()))
+            committed();
+        else
+            commitFailed();
         if (currentFile) {
             currentFile.close();
         }
 
+        // a log of this hour written by older firmware or another configuration is left as it is, the samples go
+        // to the next index
+        if (!appendable(newPath)) {
+            Serial.printf("SensorLoggingService: %s has another format, skipping it\n", newPath.c_str());
+            rotateFile(rotation.next(*sd, now), now);
+            return;
+        }
+
         currentFile = sd->openFile(newPath, FILE_APPEND);
         if (!currentFile) {
             Serial.printf("SensorLoggingService: Failed to open log file %s\n", newPath.c_str());
             return;
         }
 
+        // a fresh file starts with the channel header, an existing one was started by an earlier boot
+        logWriter.attach(&currentFile, scheduler.clock().millis());
+        logIndex.open(newPath, logWriter.fileSize() == 0);
+        if (logWriter.fileSize() == 0) {
+            uint8_t header[SAMPLE_LOG_MAX_HEADER];
+            logHeader.createdUnix = (uint32_t)now;
+            logWriter.append(header, SampleLogEncoder::encodeHeader(logHeader, header, sizeof(header)), 0,
+                             scheduler.clock().millis());
+        }
+
+        // every file starts with a logged sample, a reader of this file alone knows the values
+        deadband.reset();
         currentPath = newPath;
         Serial.printf("SensorLoggingService: Logging to %s\n", newPath.c_str());
     }
 
-    void logSensors() {
-        time_t now = wifi->getUnixTime();
-        String filePath = getLogFilePath(now);
+    // sampler task: true once per output period with every conversion of that period averaged. Until NTP set
+    // the clock a sample's time is the uptime; it is logged all the same, a device that never syncs (AP mode)
+    // still keeps its data, in 1970 log files
+    bool readSensors(SensorSample& sample) {
+        if (!decimator.poll(sample.values))
+            return false;
+        sample.timestamp = (uint32_t)scheduler.clock().unixTime();
+        retained.push(sample);
+        live.publish(sample);
+        if (!WiFiService::isSyncedTime(sample.timestamp))
+            unsynced++;
+        else if (sessionFrom.load(std::memory_order_relaxed) == 0)
+            sessionFrom.store(sample.timestamp, std::memory_order_relaxed);
+        return true;
+    }
 
-        if (!currentFile || currentPath != filePath || currentFile.size() >= MAX_FILE_SIZE) {
-            rotateFile(filePath);
+    // the open block into the group commit buffer; it counts as buffered since its first sample,
+    // so the durability bound covers the time samples spent in the encoder. Its index entry follows the commit
+    void closeBlock() {
+        uint16_t samples = blockEncoder.samples();
+        size_t length = blockEncoder.finish(blockBuffer);
+        if (length == 0)
+            return;
+        uint32_t offset = (uint32_t)logWriter.fileSize();
+        logWriter.append(blockBuffer, length, samples, blockOpenedMs);
+        appendedTimestamp = lastAddedTimestamp;
+        if (!logIndex.add(SampleBlockDecoder::firstTimestamp(blockBuffer), offset)) {
+            if (logWriter.commit(scheduler.clock().millis()))
+                committed();
+            else
+                commitFailed();
         }
+    }
 
-        DynamicJsonDocument doc(512);
-        doc["timestamp"] = now;
-        doc["ADC4"] = valueADC4;
-        doc["ADC5"] = valueADC5;
-        doc["ADC6"] = valueADC6;
+    void writeSample(const SensorSample& sample, unsigned long nowMs) {
+        // a session starts at the first sample of this boot on the uptime clock, and at the first one on the synced
+        // clock (replayed ones of the last run come before it). That sample opens a block marked as a new session
+        // and is logged whatever it holds, so no reader fills values across a restart or the clock step at sync
+        bool synced = WiFiService::isSyncedTime(sample.timestamp);
+        uint32_t first = sessionFrom.load(std::memory_order_relaxed);
+        bool starts = synced ? !sessionLogged && first && sample.timestamp >= first : !uptimeSessionLogged;
+        if (starts) {
+            (synced ? sessionLogged : uptimeSessionLogged) = true;
+            closeBlock();
+            blockEncoder.startSession();
+            deadband.reset();
+        }
 
-        serializeJson(doc, currentFile);
-        currentFile.print('\n');
-        currentFile.flush();
+        time_t now = sample.timestamp;
+        if (!currentFile || rotation.due(now, logWriter.fileSize()))
+            rotateFile(rotation.next(*sd, now), now);
+        if (!currentFile)
+            return;
+
+        rollups.add(sample);
+        if (!deadband.keep(sample)) {
+            // held by the last logged sample: covered once that one is, the retained ring need not replay it
+            if (blockEncoder.samples() > 0)
+                lastAddedTimestamp = sample.timestamp;
+            else
+                appendedTimestamp = sample.timestamp;
+            heldSample = sample;
+            heldPending = true;
+            return;
+        }
+        logSample(sample, nowMs);
+    }
+
+    // into the open block, which closes once it holds all it may
+    void logSample(const SensorSample& sample, unsigned long nowMs) {
+        if (!blockEncoder.fits(sample.timestamp))
+            closeBlock();
+        if (blockEncoder.samples() == 0)
+            blockOpenedMs = nowMs;
+        blockEncoder.add(sample);
+        lastAddedTimestamp = sample.timestamp;
+        heldPending = false;
+        if (!blockEncoder.fits(sample.timestamp))
+            closeBlock();
+    }
+
+    // writer task: samples are packed into blocks, blocks go into the group commit buffer, the card only sees
+    // whole sectors and policy commits. A block closes when it holds a commit's worth of samples or is as old as
+    // the durability bound, so every commit ends on a block boundary.
+    // Without a ready card the batch is dropped here, its samples stay in the retained ring and are replayed
+    // ahead of the first batch that finds the card, as are the ones the last run did not commit.
+    void writeBatch(const SensorSample* batch, size_t count) {
+        if (count == 0)
+            return;
+        if (!sd->ready()) {
+            replayPending = true;
+            return;
+        }
+        if (!cardOpen)
+            openCard();
+
+        unsigned long nowMs = scheduler.clock().millis();
+        if (replayPending) {
+            replayPending = false;
+            size_t n = retained.replay(batch[0].timestamp, [this, nowMs](const SensorSample& sample) {
+                writeSample(sample, nowMs);
+            });
+            if (n > 0)
+                Serial.printf("SensorLoggingService: Replayed %u retained samples\n", (unsigned)n);
+            replayed += n;
+        }
+        for (size_t i = 0; i < count; ++i)
+            writeSample(batch[i], nowMs);
+        if (blockEncoder.samples() > 0 && nowMs - blockOpenedMs >= logWriter.getPolicy().durabilityMs)
+            closeBlock();
+        if (logWriter.due(nowMs)) {
+            if (logWriter.commit(nowMs)) {
+                committed();
+                rollups.flush();
+            } else {
+                commitFailed();
+            }
+        }
     }
 };
 
@@ -0,0 +1,321 @@
+#ifndef SENSORLOG_SERIES_QUERY_H
+#define SENSORLOG_SERIES_QUERY_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <time.h>
+
+#include "../sdcard/SDCardService.h"
+#include "LogRotation.h"
+#include "RollupFiles.h"
+#include "../../pipeline/sample_log_reader.h"
+
+#define SERIES_DEFAULT_POINTS 500
+#define SERIES_MAX_POINTS 2000
+#define SERIES_LINE_SIZE 256
+#define SERIES_MAX_QUERIES 2  // responses streaming at once, each holds a SeriesQuery
+
+// each query holds a log and its index open; the logger needs two and downloads and the editor want some left
+static_assert(2 + 2 * SERIES_MAX_QUERIES + 2 <= SD_MAX_OPEN_FILES, "SeriesQuery: raise SD_MAX_OPEN_FILES");
+
+// /api/series document, written in pieces as the response asks for them:
+//   {"from":F,"to":T,"step":S,"source":"raw"|"1s"|"1m"|"1h","channels":["ADC4",...],
+//    "points":[[t,n,min,max,mean,...],...],"holdS":H,"bytesRead":B}
+// One point per step seconds that had data, t its start (a multiple of step), n the samples in it, then min / max /
+// mean of every requested channel (null for files without that channel). A step without a point had no data, except
+// that in a change triggered raw log a record's values hold for holdS seconds (0: every sample was logged). A point
+// with n 0 and null values is not a step: the logger restarted after it, nothing holds across it.
+
+///@brief the samples of a time range reduced to at most maxPoints points, read from whichever source fits: the raw
+/// logs when the step is shorter than every rollup, otherwise the coarsest rollup tier not longer than the step.
+/// Only the files covering the range are opened, through SampleLogReader so each costs O(log n) seeks plus the
+/// range. read() fills the buffer a chunked response hands it and picks up where it stopped, so memory is this
+/// object (about 3 KB) however long the range. Not thread safe, one response owns it.
+class SeriesQuery {
+public:
+    ~SeriesQuery() {
+        closeFiles();
+    }
+
+    // channelMask selects SENSOR_CHANNELS by bit; samplePeriodMs says which rollup tiers exist
+    void begin(SDCardService& card, uint32_t from, uint32_t to, uint32_t channelMask, uint16_t maxPoints,
+               uint32_t samplePeriodMs) {
+        sd = &card;
+        mask = channelMask;
+        rangeTo = to;
+        uint32_t span = to > from ? to - from : 1;
+        step = (span + maxPoints - 1) / maxPoints;
+        if (step == 0)
+            step = 1;
+
+        tier = -1;
+        for (size_t i = 0; i < ROLLUP_TIER_COUNT; ++i)
+            if (ROLLUP_TIERS[i].seconds <= step && ROLLUP_TIERS[i].seconds * 1000 > samplePeriodMs)
+                tier = (int)i;
+        if (tier >= 0)
+            step = (step + ROLLUP_TIERS[tier].seconds - 1) / ROLLUP_TIERS[tier].seconds * ROLLUP_TIERS[tier].seconds;
+        rangeFrom = from - from % step;
+
+        fileStart = rangeFrom;
+        fileIndex = 0;
+        phase = Phase::Head;
+        points = 0;
+        holdSeconds = 0;
+        bytesRead = 0;
+        point.start = UINT32_MAX;
+        lineLength = lineSent = 0;
+    }
+
+    const char* sourceName() const {
+        static const char* const NAMES[] = {"1s", "1m", "1h"};
+        return tier < 0 ? "raw" : NAMES[tier];
+    }
+
+    // the next bytes of the document into out, 0 once all of it was read
+    size_t read(uint8_t* out, size_t capacity) {
+        size_t written = 0;
+        while (written < capacity) {
+            if (lineSent == lineLength) {
+                lineLength = lineSent = 0;
+                if (!produce())
+                    break;
+                continue;
+            }
+            size_t n = lineLength - lineSent < capacity - written ? lineLength - lineSent : capacity - written;
+            memcpy(out + written, line + lineSent, n);
+            lineSent += n;
+            written += n;
+        }
+        return written;
+    }
+
+private:
+    enum class Phase : uint8_t { Head, Points, Tail, Done };
+
+    struct Point {
+        uint32_t start;
+        uint32_t count;
+        uint16_t minValue[SENSOR_CHANNEL_COUNT];
+        uint16_t maxValue[SENSOR_CHANNEL_COUNT];
+        uint64_t sum[SENSOR_CHANNEL_COUNT];
+        uint32_t samples[SENSOR_CHANNEL_COUNT];  // per channel, files of older firmware may lack one
+    };
+
+    SDCardService* sd = nullptr;
+    uint32_t mask = 0;
+    uint32_t rangeFrom = 0;
+    uint32_t rangeTo = 0;
+    uint32_t step = 1;
+    int tier = -1;  // ROLLUP_TIERS index, -1 for the raw logs
+    Phase phase = Phase::Done;
+
+    // the file being read and the next one to try
+    File logFile;
+    File indexFile;
+    bool fileOpen = false;
+    time_t fileStart = 0;
+    int fileIndex = 0;
+    uint8_t tableChannel[SAMPLE_LOG_MAX_CHANNELS];  // SENSOR_CHANNELS index of each file channel, 0xFF if none
+    SampleLogReader<File> reader;
+
+    Point point;
+    uint32_t points = 0;
+    uint32_t holdSeconds = 0;
+    size_t bytesRead = 0;
+    char line[SERIES_LINE_SIZE];
+    size_t lineLength = 0;
+    size_t lineSent = 0;
+
+    void append(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(line + lineLength, sizeof(line) - lineLength, format, args);
+        va_end(args);
+        if (n > 0)
+            lineLength = lineLength + n < sizeof(line) ? lineLength + n : sizeof(line) - 1;
+    }
+
+    // the next piece of the document into line, false after the last one
+    bool produce() {
+        switch (phase) {
+            case Phase::Head: {
+                append("{\"from\":%lu,\"to\":%lu,\"step\":%lu,\"source\":\"%s\",\"channels\":[",
+                       (unsigned long)rangeFrom, (unsigned long)rangeTo, (unsigned long)step, sourceName());
+                bool first = true;
+                for (size_t c = 0; c < SENSOR_CHANNEL_COUNT; ++c) {
+                    if (mask & (1u << c)) {
+                        append(first ? "\"%s\"" : ",\"%s\"", SENSOR_CHANNELS[c].name);
+                        first = false;
+                    }
+                }
+                append("],\"points\":[");
+                phase = Phase::Points;
+                return true;
+            }
+            case Phase::Points:
+                if (!nextPoint())
+                    phase = Phase::Tail;
+                return true;
+            case Phase::Tail:
+                closeFiles();
+                append("],\"holdS\":%lu,\"bytesRead\":%lu}", (unsigned long)holdSeconds, (unsigned long)bytesRead);
+                phase = Phase::Done;
+                return true;
+            case Phase::Done:
+                break;
+        }
+        return false;
+    }
+
+    // folds input into the open point until the next one starts, then formats the finished point.
+    // False when the range is exhausted and the last point is out
+    bool nextPoint() {
+        uint32_t timestamp;
+        const uint16_t* values;
+        while (nextInput(timestamp, values)) {
+            uint32_t start = timestamp - timestamp % step;
+            bool finished = point.start != UINT32_MAX && start != point.start;
+            if (finished)
+                formatPoint();
+            if (finished && reader.sessionStart() && start - point.start > step) {
+                // sampling stopped somewhere before this sample, an empty point ends the held values
+                resetPoint(point.start + step);
+                formatPoint();
+            }
+            if (point.start != start)
+                resetPoint(start);
+            addInput(values);
+            if (finished)
+                return true;
+        }
+        if (point.start == UINT32_MAX)
+            return false;
+        formatPoint();
+        point.start = UINT32_MAX;
+        return true;
+    }
+
+    void resetPoint(uint32_t start) {
+        point.start = start;
+        point.count = 0;
+        for (size_t c = 0; c < SENSOR_CHANNEL_COUNT; ++c) {
+            point.minValue[c] = 0xFFFF;
+            point.maxValue[c] = 0;
+            point.sum[c] = 0;
+            point.samples[c] = 0;
+        }
+    }
+
+    // a raw sample, or a rollup record: count, then min / max / mean per file channel
+    void addInput(const uint16_t* values) {
+        const SampleLogHeader& header = reader.header();
+        uint32_t count = header.rollup ? values[0] : 1;
+        point.count += count;
+        for (uint8_t f = 0; f < header.channelCount; ++f) {
+            uint8_t c = tableChannel[f];
+            if (c == 0xFF)
+                continue;
+            uint16_t minValue = header.rollup ? values[1 + 3 * f] : values[f];
+            uint16_t maxValue = header.rollup ? values[2 + 3 * f] : values[f];
+            uint16_t mean = header.rollup ? values[3 + 3 * f] : values[f];
+            if (minValue < point.minValue[c])
+                point.minValue[c] = minValue;
+            if (maxValue > point.maxValue[c])
+                point.maxValue[c] = maxValue;
+            point.sum[c] += (uint64_t)mean * count;
+            point.samples[c] += count;
+        }
+    }
+
+    void formatPoint() {
+        append(points++ ? ",[%lu,%lu" : "[%lu,%lu", (unsigned long)point.start, (unsigned long)point.count);
+        for (size_t c = 0; c < SENSOR_CHANNEL_COUNT; ++c) {
+            if (!(mask & (1u << c)))
+                continue;
+            if (point.samples[c] == 0)
+                append(",null,null,null");
+            else
+                append(",%u,%u,%u", point.minValue[c], point.maxValue[c],
+                       (unsigned)((point.sum[c] + point.samples[c] / 2) / point.samples[c]));
+        }
+        append("]");
+    }
+
+    // the next sample or bucket of the range from the open file, moving on through the files that cover it
+    bool nextInput(uint32_t& timestamp, const uint16_t*& values) {
+        while (true) {
+            if (fileOpen && reader.next(timestamp, values))
+                return true;
+            if (!openNextFile())
+                return false;
+        }
+    }
+
+    // every index of each hour (raw logs) or of each rollup's hour, day or year in turn
+    bool openNextFile() {
+        bool wasOpen = fileOpen;
+        closeFiles();
+        FileSpan span = tier < 0 ? FileSpan::Hour : ROLLUP_TIERS[tier].span;
+        while ((uint32_t)fileStart < rangeTo) {
+            if (wasOpen)
+                fileIndex++;
+            String path;
+            if (tier < 0) {
+                path = LogRotation::pathFor(fileStart, fileIndex);
+            } else {
+                char name[48];
+                rollupPath(tier, fileStart, fileIndex, name, sizeof(name));
+                path = name;
+            }
+            if (!sd->fileExists(path)) {
+                fileStart = fileSpanEnd(fileStart, span);
+                fileIndex = 0;
+                wasOpen = false;
+                continue;
+            }
+            if (openFile(path))
+                return true;
+            closeFiles();  // unreadable, on to the next one
+            wasOpen = true;
+        }
+        return false;
+    }
+
+    bool openFile(const String& path) {
+        logFile = sd->openFile(path, FILE_READ);
+        if (!logFile)
+            return false;
+        char index[48];
+        if (tier < 0 && sample_index::indexPath(path.c_str(), index, sizeof(index)) && sd->fileExists(index))
+            indexFile = sd->openFile(index, FILE_READ);
+        fileOpen = true;
+        if (!reader.open(&logFile, indexFile ? &indexFile : nullptr) || reader.header().rollup != (tier >= 0))
+            return false;
+
+        const SampleLogHeader& header = reader.header();
+        for (uint8_t f = 0; f < header.channelCount; ++f) {
+            tableChannel[f] = 0xFF;
+            for (size_t c = 0; c < SENSOR_CHANNEL_COUNT; ++c)
+                if ((mask & (1u << c)) && strcmp(header.channels[f].name, SENSOR_CHANNELS[c].name) == 0)
+                    tableChannel[f] = (uint8_t)c;
+        }
+        uint32_t hold = header.deadbanded() ? header.heartbeatSeconds() + (header.samplePeriodMs + 999) / 1000 : 0;
+        if (hold > holdSeconds)
+            holdSeconds = hold;
+        return reader.seek(rangeFrom, rangeTo);
+    }
+
+    void closeFiles() {
+        if (!fileOpen)
+            return;
+        bytesRead += reader.bytesReadSinceOpen();
+        logFile.close();
+        if (indexFile)
+            indexFile.close();
+        logFile = File();
+        indexFile = File();
+        fileOpen = false;
+    }
+};
+
+#endif
@@ -18,13 +18,17 @@ struct CookieInfo {
     bool expired;
 };
 
-class WebCookieService : public IService {
+class WebCookieService : public ServiceBase<WebCookieService> {
 public:
-    WebCookieService(ServiceRegistry& registry, Scheduler& scheduler, const char* tag= "SensorLoggingService") : registry(registry), scheduler(scheduler), TAG(tag), isReady(false) {}
+    static constexpr ServiceId ID = SERVICE_WEBCOOKIE;
+    static constexpr const char* NAME = "WEBCOOKIE";
+    typedef ServiceList<SDCardService, WiFiService> Dependencies;
+
+    WebCookieService(ServiceRegistry& registry, Scheduler& scheduler, const char* tag = "WebCookieService") : TAG(tag), registry(registry), scheduler(scheduler), isReady(false) {}
 
     void start() override {
-        sd = registry.get<SDCardService>("SDCARD");
-        wifi = registry.get<WiFiService>("WIFI");
+        sd = registry.get<SDCardService>();
+        wifi = registry.get<WiFiService>();
 
         if (!sd || !sd->ready() || !wifi || !wifi->ready()) {
             Serial.println("WebCookieService: Required services not available.");
@@ -36,7 +40,7 @@ public:
     }
 
     void update(unsigned long) override {
-        time_t now = wifi->getUnixTime();
+        time_t now = scheduler.clock().unixTime();
         bool dirty = false;
         for (auto it = cookies.begin(); it != cookies.end(); ) {
             CookieInfo& info = it->second;
@@ -68,11 +72,11 @@ public:
     }
 
     void setCookie(const String& cookieStr, const String& name, unsigned long expireDelta, unsigned long deletionDelta) {
-        time_t now = wifi->getUnixTime();
+        time_t now = scheduler.clock().unixTime();
         cookies[cookieStr] = CookieInfo{
             name,
-            now + expireDelta,
-            now + deletionDelta,
+            (time_t)(now + expireDelta),
+            (time_t)(now + deletionDelta),
             false
         };
         saveToFile();
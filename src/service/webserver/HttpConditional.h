@@ -0,0 +1,153 @@
+#ifndef SERVICE_WEBSRV_HTTP_CONDITIONAL_H
+#define SERVICE_WEBSRV_HTTP_CONDITIONAL_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+// Validators and byte ranges for file downloads (RFC 9110): an ETag made of size and modification time, so a
+// log that grew or a file that was rewritten gets a new one without reading a byte of it, Last-Modified from the
+// same time, and the single ranges a client following a log asks for, plus whether a client takes the gzipped
+// pages. All of it works on header values only.
+namespace http_conditional {
+
+// "<size>-<mtime>" in hex, quoted
+inline void etag(size_t size, time_t modified, char* out, size_t outSize) {
+    snprintf(out, outSize, "\"%lx-%lx\"", (unsigned long)size, (unsigned long)modified);
+}
+
+// IMF-fixdate, "Sun, 06 Nov 1994 08:49:37 GMT"
+inline void httpDate(time_t t, char* out, size_t outSize) {
+    struct tm tmInfo;
+    gmtime_r(&t, &tmInfo);
+    strftime(out, outSize, "%a, %d %b %Y %H:%M:%S GMT", &tmInfo);
+}
+
+// days since 1970-01-01 of a proleptic Gregorian date, newlib has no timegm()
+inline long daysFromCivil(int year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    long era = (year >= 0 ? year : year - 399) / 400;
+    unsigned yearOfEra = (unsigned)(year - era * 400);
+    unsigned dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + (long)dayOfEra - 719468;
+}
+
+// IMF-fixdate back to unix seconds, 0 if it is not one (the obsolete formats are not worth the flash)
+inline time_t parseHttpDate(const char* s) {
+    static const char MONTHS[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    char weekday[4], month[4];
+    int day, year, hour, minute, second;
+    if (sscanf(s, "%3s, %d %3s %d %d:%d:%d GMT", weekday, &day, month, &year, &hour, &minute, &second) != 7)
+        return 0;
+    const char* m = strstr(MONTHS, month);
+    if (!m || strlen(month) != 3 || (m - MONTHS) % 3 != 0)
+        return 0;
+    long days = daysFromCivil(year, (unsigned)((m - MONTHS) / 3 + 1), (unsigned)day);
+    return (time_t)(days * 86400L + hour * 3600L + minute * 60L + second);
+}
+
+// If-None-Match: "*" or a list of entity tags, compared weakly as GET wants it
+inline bool noneMatchHits(const char* header, const char* tag) {
+    size_t tagLength = strlen(tag);
+    for (const char* p = header; *p;) {
+        while (*p == ' ' || *p == ',')
+            p++;
+        if (*p == '*')
+            return true;
+        if (p[0] == 'W' && p[1] == '/')
+            p += 2;
+        const char* end = strchr(p, ',');
+        size_t length = end ? (size_t)(end - p) : strlen(p);
+        while (length > 0 && p[length - 1] == ' ')
+            length--;
+        if (length == tagLength && strncmp(p, tag, length) == 0)
+            return true;
+        if (!end)
+            break;
+        p = end + 1;
+    }
+    return false;
+}
+
+// Accept-Encoding allows a gzip body: gzip, x-gzip or * listed without q=0, where an explicit gzip entry wins
+// over *. An empty value only allows identity; no header at all allows anything, the caller checks for that
+inline bool acceptsGzip(const char* header) {
+    bool listed = false, gzip = false, any = false;
+    for (const char* p = header; *p;) {
+        while (*p == ' ' || *p == ',')
+            p++;
+        const char* end = strchr(p, ',');
+        size_t length = end ? (size_t)(end - p) : strlen(p);
+        const char* params = (const char*)memchr(p, ';', length);
+        size_t nameLength = params ? (size_t)(params - p) : length;
+        while (nameLength > 0 && p[nameLength - 1] == ' ')
+            nameLength--;
+        bool allowed = true;
+        if (params) {
+            params++;
+            while (*params == ' ')
+                params++;
+            if ((params[0] == 'q' || params[0] == 'Q') && params[1] == '=')
+                allowed = strtod(params + 2, nullptr) > 0;
+        }
+        if ((nameLength == 4 && strncasecmp(p, "gzip", 4) == 0) ||
+            (nameLength == 6 && strncasecmp(p, "x-gzip", 6) == 0)) {
+            listed = true;
+            gzip = gzip || allowed;
+        } else if (nameLength == 1 && *p == '*') {
+            any = allowed;
+        }
+        if (!end)
+            break;
+        p = end + 1;
+    }
+    return listed ? gzip : any;
+}
+
+enum class RangeResult : uint8_t {
+    Whole,          // no usable Range header: 200 with the whole file
+    Partial,        // 206 with first..last
+    Unsatisfiable,  // 416, Content-Range: bytes */size
+};
+
+// Range: bytes=first-last, bytes=first- or bytes=-suffix. Several ranges are answered with the whole file, which
+// the RFC allows, as is anything that does not parse
+inline RangeResult parseRange(const char* header, size_t size, size_t& first, size_t& last) {
+    if (strncmp(header, "bytes=", 6) != 0 || strchr(header, ','))
+        return RangeResult::Whole;
+    const char* p = header + 6;
+    char* end;
+    if (*p == '-') {
+        unsigned long suffix = strtoul(p + 1, &end, 10);
+        if (end == p + 1 || *end)
+            return RangeResult::Whole;
+        if (suffix == 0 || size == 0)
+            return RangeResult::Unsatisfiable;
+        first = suffix < size ? size - suffix : 0;
+        last = size - 1;
+        return RangeResult::Partial;
+    }
+    unsigned long from = strtoul(p, &end, 10);
+    if (end == p || *end != '-')
+        return RangeResult::Whole;
+    p = end + 1;
+    unsigned long to = size ? size - 1 : 0;
+    if (*p) {
+        to = strtoul(p, &end, 10);
+        if (end == p || *end || to < from)
+            return RangeResult::Whole;
+    }
+    if (from >= size)
+        return RangeResult::Unsatisfiable;
+    first = from;
+    last = to < size ? to : size - 1;
+    return RangeResult::Partial;
+}
+
+}  // namespace http_conditional
+
+#endif
@@ -7,27 +7,36 @@
 #include <Adafruit_NeoPixel.h>
 #include "mbedtls/sha256.h"
 
+#include <atomic>
+#include <memory>
+#include <new>
+
 
 #include "../IService.h"
 #include "../ServiceRegistry.h"
 #include "../eeprom/EEPROMService.h"
+#include "../sdcard/FileTreeStream.h"
 #include "../sdcard/SDCardService.h"
+#include "../sensorlog/SensorLoggingService.h"
+#include "../sensorlog/SeriesQuery.h"
+#include "../../scheduler/coro.h"
 #include "../../scheduler/scheduler.h"
-#include "html/index_html.h"
-#include "html/editor_html.h"
-#include "html/login_html.h"
-#include "html/graph_html.h"
-#include "html/filebrowser_html.h"
+#include "HttpConditional.h"
+#include "html/pages_gz.h"
 
-class WebServerService : public IService {
+class WebServerService : public ServiceBase<WebServerService> {
 public:
-    WebServerService(ServiceRegistry& registry, Scheduler& scheduler, const char* tag = "WebServerService") : scheduler(scheduler), server(80), registry(registry), TAG(tag), isReady(false) {}
+    static constexpr ServiceId ID = SERVICE_WEBSERVER;
+    static constexpr const char* NAME = "WEBSERVER";
+    typedef ServiceList<EEPROMService, SDCardService, WiFiService> Dependencies;
+
+    WebServerService(ServiceRegistry& registry, Scheduler& scheduler, const char* tag = "WebServerService") : TAG(tag), registry(registry), scheduler(scheduler), server(80), isReady(false) {}
 
     void start() override {
         strip.begin();
         strip.show();
 
-        sd = registry.get<SDCardService>("SDCARD");
+        sd = registry.get<SDCardService>();
 
         // CAPTIVE PORTAL REDIRECTS
         server.on("/connecttest.txt", [](AsyncWebServerRequest* req) { req->redirect("/"); });
@@ -39,12 +48,12 @@ public:
         server.on("/success.txt", [](AsyncWebServerRequest* req) { req->send(200); });
         server.on("/ncsi.txt", [](AsyncWebServerRequest* req) { req->redirect("/"); });
 
-        // STATIC PAGES
-        server.on("/", HTTP_GET, [](AsyncWebServerRequest* req) {req->send(200, "text/html", INDEX_HTML);});
-        server.on("/editor", HTTP_GET, [](AsyncWebServerRequest* req) { req->send(200, "text/html", EDITOR_HTML);});
-        server.on("/login", HTTP_GET, [](AsyncWebServerRequest* req) {req->send(200, "text/html", LOGIN_HTML);});
-        server.on("/graph", HTTP_GET, [](AsyncWebServerRequest* req) {req->send(200, "text/html", GRAPH_HTML);});
-        server.on("/tree", HTTP_GET, [](AsyncWebServerRequest* req) {req->send(200, "text/html", FILEBROWSER_HTML);});
+        // STATIC PAGES, gzipped at build time by tools/build_html.py
+        server.on("/", HTTP_GET, [](AsyncWebServerRequest* req) { sendPage(req, INDEX_HTML_PAGE); });
+        server.on("/editor", HTTP_GET, [](AsyncWebServerRequest* req) { sendPage(req, EDITOR_HTML_PAGE); });
+        server.on("/login", HTTP_GET, [](AsyncWebServerRequest* req) { sendPage(req, LOGIN_HTML_PAGE); });
+        server.on("/graph", HTTP_GET, [](AsyncWebServerRequest* req) { sendPage(req, GRAPH_HTML_PAGE); });
+        server.on("/tree", HTTP_GET, [](AsyncWebServerRequest* req) { sendPage(req, FILEBROWSER_HTML_PAGE); });
         //AUTH HANDLE
         server.on("/auth", HTTP_POST,
             [](AsyncWebServerRequest *req) { //CONTENT ASSERTION
@@ -53,7 +62,7 @@ public:
                 if (req->_tempObject != nullptr) 
                     return;
             },nullptr,
-            [this](AsyncWebServerRequest *req, uint8_t *data, size_t len, size_t index, size_t total) { //CONTENT VALIDATION
+            [this](AsyncWebServerRequest *req, uint8_t *data, size_t len, size_t index, size_t) { //CONTENT VALIDATION
                 if (index != 0) 
                     return;
                 DynamicJsonDocument doc(512);
@@ -137,7 +146,7 @@ public:
                     return;
                 }
             }, nullptr,
-            [this](AsyncWebServerRequest *req, uint8_t *data, size_t len, size_t index, size_t total) {
+            [this](AsyncWebServerRequest *req, uint8_t *data, size_t len, size_t index, size_t) {
                 if (index != 0) 
                     return;
                 DynamicJsonDocument doc(256);
@@ -156,7 +165,7 @@ public:
                     return;
                 }
 
-                EEPROMService* eeprom = registry.get<EEPROMService>("EEPROM");
+                EEPROMService* eeprom = registry.get<EEPROMService>();
                 if (!eeprom) {
                     req->send(500, "application/json", "{\"error\":\"EEPROMService not available\"}");
                     return;
@@ -178,7 +187,7 @@ public:
 
                 req->send(200, "application/json", "{\"status\":\"success\"}");
 
-                scheduler.addTask([]() { ESP.restart(); }, 100, false);
+                scheduleRestart();
             }
         );
         server.on("/clear-logs/", HTTP_POST,
@@ -208,11 +217,11 @@ public:
                     return;
                 }
                 req->send(200, "application/json", "{\"status\":\"restarting\"}");
-                scheduler.addTask([]() { ESP.restart(); }, 100, false);  // delay a bit to let response finish
+                scheduleRestart();
             }
         );
-        server.on("/led/", HTTP_POST, [](AsyncWebServerRequest *req) {}, nullptr,
-            [this](AsyncWebServerRequest *req, uint8_t *data, size_t len, size_t index, size_t total) {
+        server.on("/led/", HTTP_POST, [](AsyncWebServerRequest*) {}, nullptr,
+            [this](AsyncWebServerRequest *req, uint8_t *data, size_t len, size_t index, size_t) {
                 if (index != 0) return; // only process once
 
                 DynamicJsonDocument doc(128);
@@ -251,15 +260,40 @@ public:
             }
         );
 
-        server.on("/api/tree/", HTTP_GET, 
-            [this](AsyncWebServerRequest *request) {
-                StaticJsonDocument<8192> doc;
-                JsonObject root = doc.to<JsonObject>();
-                sd->buildFileTree(root);
+        // /api/tree/?path=/logs&depth=1&offset=0&limit=100, see FileTreeStream for the document. Streamed while it
+        // is sent, so a directory of thousands of logs costs the same memory as an empty one
+        server.on("/api/tree/", HTTP_GET,
+            [this](AsyncWebServerRequest *req) {
+                if (!sd || !sd->ready()) {
+                    req->send(500, "application/json", "{\"error\":\"SD card not ready\"}");
+                    return;
+                }
+                String path = req->hasParam("path") ? req->getParam("path")->value() : String("/");
+                long depth = req->hasParam("depth") ? req->getParam("depth")->value().toInt() : TREE_DEFAULT_DEPTH;
+                long offset = req->hasParam("offset") ? req->getParam("offset")->value().toInt() : 0;
+                long limit = req->hasParam("limit") ? req->getParam("limit")->value().toInt() : TREE_DEFAULT_LIMIT;
+                if (!path.startsWith("/") || depth < 1 || depth > TREE_MAX_DEPTH || offset < 0 || limit < 1 ||
+                    limit > TREE_MAX_LIMIT) {
+                    req->send(400, "application/json", "{\"error\":\"Need an absolute path, 1 <= depth <= 4, 1 <= limit <= 500\"}");
+                    return;
+                }
 
-                String output;
-                serializeJson(doc, output);
-                request->send(200, "application/json", output);
+                FileTreeStream* tree = treeStreams < TREE_MAX_STREAMS ? new (std::nothrow) FileTreeStream() : nullptr;
+                if (!tree) {
+                    req->send(503, "application/json", "{\"error\":\"Too many tree listings\"}");
+                    return;
+                }
+                treeStreams++;
+                std::shared_ptr<FileTreeStream> owned(tree, [this](FileTreeStream* t) {
+                    delete t;
+                    treeStreams--;
+                });
+                if (!tree->begin(*sd, path, (uint8_t)depth, (uint32_t)offset, (uint16_t)limit)) {
+                    req->send(404, "application/json", "{\"error\":\"Directory not found\"}");
+                    return;
+                }
+                req->send(req->beginChunkedResponse("application/json",
+                    [owned](uint8_t* buffer, size_t maxLen, size_t) { return owned->read(buffer, maxLen); }));
             }
         );
 
@@ -289,8 +323,7 @@ public:
                     req->send(500, "application/json", "{\"error\":\"Failed to open file\"}");
                     return;
                 }
-
-                req->send(req->beginResponse(file, wildcard, "application/octet-stream", false));
+                req->send(fileResponse(req, file, wildcard));
             }
         );
 
@@ -305,7 +338,7 @@ public:
                     return;
                 }
             }, nullptr,
-            [this](AsyncWebServerRequest* req, uint8_t* data, size_t len, size_t index, size_t total) {
+            [this](AsyncWebServerRequest* req, uint8_t* data, size_t len, size_t index, size_t) {
                 if (index != 0)
                     return;  // handle only once
 
@@ -365,6 +398,238 @@ public:
                 request->send(200, "application/json", json);
             }
         );
+        server.on("/api/scheduler", HTTP_GET,
+            [this](AsyncWebServerRequest *request) {
+                DynamicJsonDocument doc(4096);
+                LoopStats loop = scheduler.loopStats();
+                JsonObject loopObj = doc.createNestedObject("loop");
+                loopObj["wakeupsPerSec"] = loop.wakeupsPerSec;
+                loopObj["idlePercent"] = loop.idlePercent;
+                loopObj["wakeups"] = loop.wakeups;
+                loopObj["idleMs"] = loop.idleUs / 1000;
+
+                CoroArenaStats arena = CoroArena::stats();
+                JsonObject arenaObj = doc.createNestedObject("coroArena");
+                arenaObj["slots"] = arena.slots;
+                arenaObj["inUse"] = arena.inUse;
+                arenaObj["frameSize"] = arena.frameSize;
+                arenaObj["largestFrame"] = arena.largestFrame;
+                arenaObj["failed"] = arena.failed;
+
+                JsonArray bounds = doc.createNestedArray("histBoundsUs");
+                for (uint32_t bound : SCHEDULER_HIST_BOUNDS_US)
+                    bounds.add(bound);
+
+                JsonArray tasks = doc.createNestedArray("tasks");
+                scheduler.forEachTask([&tasks](const char* name, unsigned long interval, bool repeat, bool paused, const TaskStats& stats) {
+                    JsonObject task = tasks.createNestedObject();
+                    task["name"] = name;
+                    task["intervalMs"] = interval;
+                    task["repeat"] = repeat;
+                    task["paused"] = paused;
+                    task["runs"] = stats.runs;
+                    task["lateAvgMs"] = stats.runs ? stats.lateSumMs / stats.runs : 0;
+                    task["lateMaxMs"] = stats.lateMaxMs;
+                    task["execMinUs"] = stats.execMinUs;
+                    task["execAvgUs"] = stats.runs ? stats.execSumUs / stats.runs : 0;
+                    task["execMaxUs"] = stats.execMaxUs;
+                    task["missedPeriods"] = stats.missedPeriods;
+                    task["catchUpBursts"] = stats.catchUpBursts;
+                    JsonArray hist = task.createNestedArray("histogram");
+                    for (uint32_t count : stats.histogram)
+                        hist.add(count);
+                });
+
+                String json;
+                serializeJson(doc, json);
+                request->send(200, "application/json", json);
+            }
+        );
+
+        server.on("/api/boot", HTTP_GET,
+            [this](AsyncWebServerRequest *request) {
+                DynamicJsonDocument doc(1024);
+                doc["done"] = registry.startupDone();
+                doc["bootTimeMs"] = registry.bootTimeMs();
+                JsonArray services = doc.createNestedArray("services");
+                registry.forEachBoot([&services](const ServiceBoot& boot) {
+                    JsonObject service = services.createNestedObject();
+                    service["name"] = boot.name;
+                    service["started"] = boot.started;
+                    service["ready"] = boot.isReady;
+                    service["startMs"] = boot.startMs;
+                    service["readyMs"] = boot.readyMs;
+                });
+                String json;
+                serializeJson(doc, json);
+                request->send(200, "application/json", json);
+            }
+        );
+        server.on("/api/pipeline", HTTP_GET,
+            [this](AsyncWebServerRequest *request) {
+                SensorLoggingService* sensorlog = registry.get<SensorLoggingService>();
+                if (!sensorlog || !sensorlog->ready()) {
+                    request->send(503, "application/json", "{\"error\":\"Sensor logging not running\"}");
+                    return;
+                }
+                PipelineStats stats = sensorlog->pipelineStats();
+                DynamicJsonDocument doc(512);
+                doc["depth"] = stats.depth;
+                doc["maxDepth"] = stats.maxDepth;
+                doc["capacity"] = stats.capacity;
+                doc["produced"] = stats.produced;
+                doc["dropped"] = stats.dropped;
+                doc["written"] = stats.written;
+                doc["batches"] = stats.batches;
+                doc["replayed"] = sensorlog->replayedSamples();
+                doc["unsynced"] = sensorlog->unsyncedSamples();
+                doc["liveSubscribers"] = liveSubscribers.load();
+                doc["liveDropped"] = liveDropped.load();
+
+                GroupCommitStats commit = sensorlog->writerStats();
+                const CommitPolicy& policy = sensorlog->commitPolicy();
+                JsonObject writer = doc.createNestedObject("writer");
+                writer["commitSamples"] = policy.maxSamples;
+                writer["durabilityMs"] = policy.durabilityMs;
+                writer["buffered"] = commit.buffered;
+                writer["bufferSize"] = commit.capacity;
+                writer["commits"] = commit.commits;
+                writer["failedCommits"] = commit.failedCommits;
+                writer["commitsPerHour"] = commit.commitsPerHour;
+                writer["sectorWrites"] = commit.sectorWrites;
+                writer["commitLastUs"] = commit.commitLastUs;
+                writer["commitMaxUs"] = commit.commitMaxUs;
+                writer["bytesWritten"] = commit.bytesWritten;
+                String json;
+                serializeJson(doc, json);
+                request->send(200, "application/json", json);
+            }
+        );
+
+        // /api/series?from=&to=&channels=ADC4,ADC6&maxPoints=500, unix seconds; see SeriesQuery for the document.
+        // The response is generated while it is sent, a few KB of heap per query however long the range
+        server.on("/api/series", HTTP_GET,
+            [this](AsyncWebServerRequest* req) {
+                if (!isAuthenticated(req)) {
+                    req->send(403, "text/plain", "Forbidden");
+                    return;
+                }
+                if (!sd || !sd->ready()) {
+                    req->send(500, "application/json", "{\"error\":\"SD card not ready\"}");
+                    return;
+                }
+
+                uint32_t to = req->hasParam("to") ? strtoul(req->getParam("to")->value().c_str(), nullptr, 10)
+                                                  : (uint32_t)scheduler.clock().unixTime();
+                uint32_t from = req->hasParam("from") ? strtoul(req->getParam("from")->value().c_str(), nullptr, 10)
+                                                      : to - 3600;
+                long maxPoints = req->hasParam("maxPoints") ? req->getParam("maxPoints")->value().toInt()
+                                                            : SERIES_DEFAULT_POINTS;
+                if (from >= to || maxPoints < 1 || maxPoints > SERIES_MAX_POINTS) {
+                    req->send(400, "application/json", "{\"error\":\"Need from < to and 1 <= maxPoints <= 2000\"}");
+                    return;
+                }
+
+                uint32_t mask = (1u << SENSOR_CHANNEL_COUNT) - 1;
+                if (req->hasParam("channels")) {
+                    String list = req->getParam("channels")->value() + ",";
+                    mask = 0;
+                    for (int start = 0, comma; (comma = list.indexOf(',', start)) >= 0; start = comma + 1) {
+                        String name = list.substring(start, comma);
+                        uint32_t bit = 0;
+                        for (size_t c = 0; c < SENSOR_CHANNEL_COUNT; ++c)
+                            if (name == SENSOR_CHANNELS[c].name)
+                                bit = 1u << c;
+                        if (!bit) {
+                            req->send(400, "application/json", "{\"error\":\"Unknown channel\"}");
+                            return;
+                        }
+                        mask |= bit;
+                    }
+                }
+
+                SeriesQuery* query = seriesQueries < SERIES_MAX_QUERIES ? new (std::nothrow) SeriesQuery() : nullptr;
+                if (!query) {
+                    req->send(503, "application/json", "{\"error\":\"Too many series queries\"}");
+                    return;
+                }
+                // freed with the response, also when the client goes away half way
+                seriesQueries++;
+                std::shared_ptr<SeriesQuery> owned(query, [this](SeriesQuery* q) {
+                    delete q;
+                    seriesQueries--;
+                });
+                SensorLoggingService* sensorlog = registry.get<SensorLoggingService>();
+                query->begin(*sd, from, to, mask, (uint16_t)maxPoints,
+                             sensorlog ? sensorlog->samplePeriodMs() : AdcConfig().outputPeriodMs);
+                req->send(req->beginChunkedResponse("application/json",
+                    [owned](uint8_t* buffer, size_t maxLen, size_t) { return owned->read(buffer, maxLen); }));
+            }
+        );
+
+        // /api/live: Server-Sent Events, one per sample as it is taken, see LiveFeed for the format. Every subscriber
+        // reads the same frames from memory, nothing touches the card. One that falls LIVE_FEED_FRAMES behind is
+        // dropped, its EventSource reconnects on its own
+        server.on("/api/live", HTTP_GET,
+            [this](AsyncWebServerRequest* req) {
+                if (!isAuthenticated(req)) {
+                    req->send(403, "text/plain", "Forbidden");
+                    return;
+                }
+                SensorLoggingService* sensorlog = registry.get<SensorLoggingService>();
+                if (!sensorlog || !sensorlog->ready()) {
+                    req->send(503, "application/json", "{\"error\":\"Sensor logging not running\"}");
+                    return;
+                }
+
+                LiveSubscriber* subscriber =
+                    liveSubscribers < LIVE_MAX_SUBSCRIBERS ? new (std::nothrow) LiveSubscriber() : nullptr;
+                if (!subscriber) {
+                    req->send(503, "application/json", "{\"error\":\"Too many live subscribers\"}");
+                    return;
+                }
+                liveSubscribers++;
+                std::shared_ptr<LiveSubscriber> owned(subscriber, [this](LiveSubscriber* s) {
+                    if (s->lagged())
+                        liveDropped++;
+                    delete s;
+                    liveSubscribers--;
+                });
+                subscriber->begin(sensorlog->liveFeed());
+                AsyncWebServerResponse* res = req->beginChunkedResponse("text/event-stream",
+                    [owned](uint8_t* buffer, size_t maxLen, size_t) -> size_t {
+                        // nothing new yet: asked again on the next ack or poll. Lapped: the response ends
+                        size_t n = owned->read(buffer, maxLen);
+                        return n > 0 || owned->lagged() ? n : RESPONSE_TRY_AGAIN;
+                    });
+                res->addHeader("Cache-Control", "no-cache");
+                req->send(res);
+            }
+        );
+
+        // what the firmware was built with, in log column order; dryCounts / wetCounts only once calibrated
+        server.on("/api/channels", HTTP_GET,
+            [](AsyncWebServerRequest *request) {
+                DynamicJsonDocument doc(256 + 224 * SENSOR_CHANNEL_COUNT);
+                JsonArray channels = doc.to<JsonArray>();
+                forEachChannel([&](auto i) {
+                    constexpr SensorChannel c = SENSOR_CHANNELS[i];
+                    JsonObject channel = channels.createNestedObject();
+                    channel["name"] = c.name;
+                    channel["pin"] = c.pin;
+                    channel["atten"] = attenName(c.atten);
+                    channel["deadband"] = c.logging.deadband;
+                    channel["heartbeatS"] = c.logging.heartbeatSeconds;
+                    if (c.calibration.calibrated()) {
+                        channel["dryCounts"] = c.calibration.dryCounts;
+                        channel["wetCounts"] = c.calibration.wetCounts;
+                    }
+                });
+                String json;
+                serializeJson(doc, json);
+                request->send(200, "application/json", json);
+            }
+        );
 
         // 404
         server.onNotFound(
@@ -374,6 +639,10 @@ public:
             }
         );
 
+        // handlers run on the async_tcp task and only leave the request, the scheduler is touched from loop() alone
+        if (!scheduler.addTask("restart", [this]() { restartIfRequested(); }, RESTART_POLL_MS, true).active())
+            Serial.println("WebServerService: No task to restart from, restart requests are ignored.");
+
         server.begin();
         isReady = true;
     }
@@ -406,6 +675,110 @@ private:
 
     SDCardService* sd;
     WiFiService* wifi;
+    static constexpr unsigned long RESTART_DELAY_MS = 100;  // lets the response go out first
+    static constexpr unsigned long RESTART_POLL_MS = 250;
+    std::atomic<bool> restartRequested{false};
+    std::atomic<unsigned long> restartRequestedMs{0};
+    std::atomic<uint8_t> seriesQueries{0};
+    std::atomic<uint8_t> treeStreams{0};
+    std::atomic<uint8_t> liveSubscribers{0};
+    std::atomic<uint32_t> liveDropped{0};  // subscribers that fell too far behind
+
+    // a page as pages_gz.h stores it. Browsers keep it a day, then revalidate and get 304 while the firmware has the
+    // same page; the URLs carry no version, so a longer lifetime would keep old pages after an update
+    // the pages are only in flash gzipped: a client whose Accept-Encoding rules gzip out gets 406, not a body it
+    // cannot read. Vary tells caches the answer depends on that header
+    static void sendPage(AsyncWebServerRequest* req, const StaticPage& page) {
+        AsyncWebServerResponse* res;
+        if (req->hasHeader("Accept-Encoding") &&
+            !http_conditional::acceptsGzip(req->header("Accept-Encoding").c_str())) {
+            res = req->beginResponse(406, "text/plain", "This page is only available gzip encoded");
+            res->addHeader("Vary", "Accept-Encoding");
+            req->send(res);
+            return;
+        }
+        if (req->hasHeader("If-None-Match") &&
+            http_conditional::noneMatchHits(req->header("If-None-Match").c_str(), page.etag)) {
+            res = req->beginResponse(304);
+        } else {
+            res = req->beginResponse(200, "text/html", page.gz, page.length);
+            res->addHeader("Content-Encoding", "gzip");
+        }
+        res->addHeader("ETag", page.etag);
+        res->addHeader("Cache-Control", "public, max-age=86400");
+        res->addHeader("Vary", "Accept-Encoding");
+        req->send(res);
+    }
+
+    // the file, the part of it a Range asks for (206 / 416), or 304 when the client's copy is current. The validators
+    // come from the directory entry, so a client polling a log that did not change costs no read of it, and one
+    // following a log with Range: bytes=<what it has>- gets only the appended bytes
+    AsyncWebServerResponse* fileResponse(AsyncWebServerRequest* req, File& file, const String& path) {
+        using namespace http_conditional;
+        size_t size = file.size();
+        time_t modified = file.getLastWrite();
+        bool dated = modified > 946684800;  // written with the clock set; FAT without a time says 1980
+        char tag[24], date[32];
+        etag(size, modified, tag, sizeof(tag));
+        if (dated)
+            httpDate(modified, date, sizeof(date));
+
+        // If-None-Match, when present, decides alone
+        bool notModified = req->hasHeader("If-None-Match")
+                               ? noneMatchHits(req->header("If-None-Match").c_str(), tag)
+                               : dated && req->hasHeader("If-Modified-Since") &&
+                                     modified <= parseHttpDate(req->header("If-Modified-Since").c_str());
+        size_t first = 0, last = 0;
+        RangeResult range = RangeResult::Whole;
+        // If-Range: the range is only good for the version the client has, otherwise it gets the whole file
+        if (!notModified && req->hasHeader("Range") && (!req->hasHeader("If-Range") || req->header("If-Range") == tag))
+            range = parseRange(req->header("Range").c_str(), size, first, last);
+
+        AsyncWebServerResponse* res;
+        if (notModified || range == RangeResult::Unsatisfiable) {
+            file.close();
+            res = req->beginResponse(notModified ? 304 : 416);
+            if (!notModified) {
+                char contentRange[32];
+                snprintf(contentRange, sizeof(contentRange), "bytes */%lu", (unsigned long)size);
+                res->addHeader("Content-Range", contentRange);
+            }
+        } else if (range == RangeResult::Partial) {
+            size_t length = last - first + 1;
+            res = req->beginResponse("application/octet-stream", length,
+                [file, first, length](uint8_t* buffer, size_t maxLen, size_t index) mutable -> size_t {
+                    if (index >= length || (file.position() != first + index && !file.seek(first + index)))
+                        return 0;
+                    return file.read(buffer, length - index < maxLen ? length - index : maxLen);
+                });
+            res->setCode(206);
+            char contentRange[48];
+            snprintf(contentRange, sizeof(contentRange), "bytes %lu-%lu/%lu", (unsigned long)first,
+                     (unsigned long)last, (unsigned long)size);
+            res->addHeader("Content-Range", contentRange);
+        } else {
+            res = req->beginResponse(file, path, "application/octet-stream", false);
+        }
+        res->addHeader("ETag", tag);
+        if (dated)
+            res->addHeader("Last-Modified", date);
+        res->addHeader("Accept-Ranges", "bytes");
+        return res;
+    }
+
+    // async_tcp task: asks the loop to restart once the response had RESTART_DELAY_MS to finish; repeated requests
+    // push the same restart back instead of queueing more
+    void scheduleRestart() {
+        restartRequestedMs.store(scheduler.clock().millis(), std::memory_order_relaxed);
+        restartRequested.store(true, std::memory_order_release);
+    }
+
+    // loop task, every RESTART_POLL_MS
+    void restartIfRequested() {
+        if (restartRequested.load(std::memory_order_acquire) &&
+            scheduler.clock().millis() - restartRequestedMs.load(std::memory_order_relaxed) >= RESTART_DELAY_MS)
+            ESP.restart();
+    }
 
     bool isAuthenticated(AsyncWebServerRequest* req) {
         if (!req->hasHeader("Cookie")) 
@@ -145,16 +145,41 @@ const char EDITOR_HTML[] PROGMEM = R"rawliteral(
     let currentFile = "";
     let lastContent = "";
 
+    // one directory level per request, a page of entries at a time; folders are listed when first opened
+    async function fetchTree(path, offset) {
+      const res = await fetch(`/api/tree/?path=${encodeURIComponent(path)}&offset=${offset}`);
+      if (!res.ok) throw new Error("Failed to list " + path);
+      return res.json();
+    }
+
+    function childPath(dir, name) {
+      return (dir.endsWith('/') ? dir : dir + '/') + name;
+    }
+
     async function loadTree() {
-      const res = await fetch("/api/tree/");
-      const tree = await res.json();
+      const tree = await fetchTree('/', 0);
       const root = document.getElementById("fileTree");
       root.innerHTML = '';
-      renderTree(tree, root, '');
+      renderChildren(tree, root, tree.path);
+    }
+
+    function renderChildren(node, ul, path) {
+      (node.children || []).forEach(child => renderTree(child, ul, childPath(path, child.name)));
+      if (node.next === undefined) return;
+
+      const li = document.createElement("li");
+      const label = document.createElement("span");
+      label.textContent = "more...";
+      li.appendChild(label);
+      label.addEventListener("click", function(e) {
+        e.stopPropagation();
+        li.remove();
+        fetchTree(path, node.next).then(page => renderChildren(page, ul, path));
+      });
+      ul.appendChild(li);
     }
 
-    function renderTree(node, parent, path) {
-      const fullPath = (path === '' ? '' : path) + '/' + node.name;
+    function renderTree(node, parent, fullPath) {
       const li = document.createElement("li");
       const label = document.createElement("span");
       label.textContent = node.name;
@@ -165,17 +190,20 @@ const char EDITOR_HTML[] PROGMEM = R"rawliteral(
         const ul = document.createElement("ul");
         ul.style.display = "none";
         li.appendChild(ul);
+        let listed = !!node.children;
 
         label.addEventListener("click", function(e) {
           e.stopPropagation();
           const open = ul.style.display === "block";
           ul.style.display = open ? "none" : "block";
           li.classList.toggle("open", !open);
+          if (!open && !listed) {
+            listed = true;
+            fetchTree(fullPath, 0).then(page => renderChildren(page, ul, fullPath));
+          }
         });
 
-        if (node.children) {
-          node.children.forEach(child => renderTree(child, ul, fullPath));
-        }
+        if (node.children) renderChildren(node, ul, fullPath);
       } else {
         li.classList.add("file");
         li.appendChild(label);
@@ -93,23 +93,50 @@ const char FILEBROWSER_HTML[] PROGMEM = R"rawliteral(
   </main>
 
   <script>
+    // one directory level per request, a page of entries at a time; folders are listed when first opened
+    async function fetchTree(path, offset) {
+      const res = await fetch(`/api/tree/?path=${encodeURIComponent(path)}&offset=${offset}`);
+      if (!res.ok) throw new Error("Failed to list " + path);
+      return res.json();
+    }
+
+    function childPath(dir, name) {
+      return (dir.endsWith('/') ? dir : dir + '/') + name;
+    }
+
     async function loadTree() {
       try {
-        const res = await fetch('/api/tree/');
-        const tree = await res.json();
+        const tree = await fetchTree('/', 0);
         const root = document.getElementById('fileTree');
         root.innerHTML = '';
-        renderTree(tree, root, '');
+        renderChildren(tree, root, tree.path);
       } catch (e) {
         console.error("Failed to load file tree:", e);
       }
     }
 
-    function renderTree(node, parent, currentPath) {
+    function renderChildren(node, ul, path) {
+        (node.children || []).forEach(child => renderTree(child, ul, childPath(path, child.name)));
+        if (node.next === undefined) return;
+
+        const li = document.createElement('li');
+        const label = document.createElement('span');
+        label.textContent = 'more...';
+        li.appendChild(label);
+        label.addEventListener('click', function(e) {
+            e.stopPropagation();
+            li.remove();
+            fetchTree(path, node.next)
+                .then(page => renderChildren(page, ul, path))
+                .catch(err => console.error("Failed to load file tree:", err));
+        });
+        ul.appendChild(li);
+    }
+
+    function renderTree(node, parent, fullPath) {
         if (!node) return;
 
         const li = document.createElement('li');
-        const fullPath = currentPath + '/' + node.name;
 
         const label = document.createElement('span');
         label.textContent = node.name;
@@ -120,18 +147,23 @@ const char FILEBROWSER_HTML[] PROGMEM = R"rawliteral(
             ul.style.display = 'none';
             li.appendChild(label);
             li.appendChild(ul);
+            let listed = !!node.children;
 
             label.addEventListener('click', function(e) {
             e.stopPropagation();
             const open = ul.style.display === 'block';
             ul.style.display = open ? 'none' : 'block';
             li.classList.toggle('open', !open);
+            if (!open && !listed) {
+                listed = true;
+                fetchTree(fullPath, 0)
+                    .then(page => renderChildren(page, ul, fullPath))
+                    .catch(err => console.error("Failed to load file tree:", err));
+            }
             });
 
             parent.appendChild(li);
-            if (node.children) {
-            node.children.forEach(child => renderTree(child, ul, fullPath));
-            }
+            if (node.children) renderChildren(node, ul, fullPath);
         } else {
             li.classList.add('file');
             li.appendChild(label);
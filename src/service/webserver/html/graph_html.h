@@ -49,8 +49,12 @@ const char GRAPH_HTML[] PROGMEM = R"rawliteral(
 </head>
 <body>
 <div id="controls">
-  <input type="text" id="fileInput" placeholder="/logs/20250713_14.json" size="40" />
+  <input type="text" id="fileInput" placeholder="/logs/20250713_14.bin" size="40" />
   <button onclick="loadFile()">Load</button>
+  <input type="datetime-local" id="fromInput" />
+  <input type="datetime-local" id="toInput" />
+  <button onclick="loadRange()">Load range</button>
+  <button id="liveButton" onclick="toggleLive()">Live</button>
 </div>
 <canvas id="chart"></canvas>
 
@@ -59,6 +63,7 @@ const char GRAPH_HTML[] PROGMEM = R"rawliteral(
 
 <script>
   let chart;
+  const COLORS = ['red', 'blue', 'green', 'orange', 'purple', 'cyan', 'magenta', 'yellow'];
 
   window.addEventListener('DOMContentLoaded', () => {
     const ctx = document.getElementById('chart').getContext('2d');
@@ -66,11 +71,7 @@ const char GRAPH_HTML[] PROGMEM = R"rawliteral(
       type: 'line',
       data: {
         labels: [],
-        datasets: [
-          { label: 'ADC4', borderColor: 'red', data: [], fill: false },
-          { label: 'ADC5', borderColor: 'blue', data: [], fill: false },
-          { label: 'ADC6', borderColor: 'green', data: [], fill: false }
-        ]
+        datasets: []
       },
       options: {
         responsive: true,
@@ -97,6 +98,135 @@ const char GRAPH_HTML[] PROGMEM = R"rawliteral(
     });
   });
 
+  // binary sensor log v1, see src/pipeline/sample_log.h
+  // raw logs ("SMLG") give one row per sample, rollups ("SMRU") one per bucket with the bucket mean
+  function decodeSampleLog(buf) {
+    const view = new DataView(buf);
+    const magic = String.fromCharCode(...new Uint8Array(buf, 0, Math.min(4, buf.byteLength)));
+    const rollup = magic === "SMRU";
+    const version = buf.byteLength < 16 ? 0 : view.getUint8(4);
+    if ((magic !== "SMLG" && !rollup) || !(version === 1 || (version === 2 && !rollup))) {
+      throw new Error("not a sensor log");
+    }
+    const count = view.getUint8(5);
+    const recordSize = view.getUint16(6, true);
+    const names = [];
+    let deadbanded = count > 0, heartbeat = Infinity;
+    for (let i = 0; i < count; i++) {
+      const raw = new Uint8Array(buf, 16 + 12 * i, 8);
+      names.push(String.fromCharCode(...raw).replace(/\0+$/, ""));
+      deadbanded = deadbanded && view.getUint8(16 + 12 * i + 9) > 0;
+      heartbeat = Math.min(heartbeat, view.getUint16(16 + 12 * i + 10, true));
+    }
+    if (version === 2) {
+      const sessions = new Set();
+      const rows = decodeSampleBlocks(view, 16 + 12 * count, names, sessions);
+      return deadbanded && !rollup ? fillHeld(rows, names, view.getUint32(8, true), heartbeat, sessions) : rows;
+    }
+    const rows = [];
+    for (let off = 16 + 12 * count; off + recordSize <= buf.byteLength; off += recordSize) {
+      const row = { timestamp: view.getUint32(off, true) };
+      for (let i = 0; i < count; i++) {
+        row[names[i]] = rollup ? view.getUint16(off + 6 + 6 * i + 4, true) : view.getUint16(off + 4 + 2 * i, true);
+      }
+      rows.push(row);
+    }
+    return rows;
+  }
+
+  // change triggered log, see src/pipeline/deadband.h: a record's values held until the next record if that one
+  // is at most heartbeat plus a sample period later, so those samples are filled in; a longer gap had no data
+  // and gets a row of nulls, which breaks the line. So does the gap before a row in sessions, where logging restarted
+  function fillHeld(records, names, periodMs, heartbeat, sessions) {
+    const hold = heartbeat + Math.ceil(periodMs / 1000);
+    const rows = [];
+    for (const row of records) {
+      const last = rows[rows.length - 1];
+      const gap = last ? row.timestamp - last.timestamp : 0;
+      if (gap > hold || (last && sessions.has(row))) {
+        const empty = { timestamp: last.timestamp + 1 };
+        for (const name of names) empty[name] = null;
+        rows.push(empty);
+      } else if (gap > 0) {
+        for (let k = 1, emitted = last.timestamp; (k + 1) * periodMs <= gap * 1000 + 500; k++) {
+          const t = last.timestamp + Math.floor(k * periodMs / 1000);
+          if (t !== emitted && t !== row.timestamp) rows.push({ ...last, timestamp: t });
+          emitted = t;
+        }
+      }
+      rows.push(row);
+    }
+    return rows;
+  }
+
+  // version 2 body, see src/pipeline/sample_codec.h: per block the first sample raw, then bit packed
+  // zig-zag deltas (delta of delta for the timestamp) at the widths the block header gives. The top bit of the
+  // sample count marks the first block of a logging session, its first row goes into sessions
+  function decodeSampleBlocks(view, off, names, sessions) {
+    const count = names.length;
+    const rows = [];
+    const unzigzag = (z) => (z >>> 1) ^ -(z & 1);
+    while (off + 9 + 3 * count <= view.byteLength) {
+      const samples = view.getUint16(off, true) & 0x7FFF;
+      const session = (view.getUint16(off, true) & 0x8000) !== 0;
+      const payload = view.getUint16(off + 2, true);
+      const widths = [];
+      let bitsPerSample = 0;
+      for (let f = 0; f <= count; f++) {
+        widths.push(view.getUint8(off + 8 + 2 * count + f));
+        bitsPerSample += widths[f];
+      }
+      const start = off + 9 + 3 * count;
+      if (samples === 0 || payload !== Math.ceil((samples - 1) * bitsPerSample / 8) || start + payload > view.byteLength) {
+        break;  // torn tail
+      }
+      let ts = view.getUint32(off + 4, true), delta = 0;
+      const values = [];
+      for (let i = 0; i < count; i++) values.push(view.getUint16(off + 8 + 2 * i, true));
+      const emit = () => {
+        const row = { timestamp: ts };
+        for (let i = 0; i < count; i++) row[names[i]] = values[i];
+        rows.push(row);
+      };
+      emit();
+      if (session) sessions.add(rows[rows.length - 1]);
+      let p = start, bits = 0, available = 0;
+      for (let s = 1; s < samples; s++) {
+        for (let f = 0; f <= count; f++) {
+          while (available < widths[f]) {
+            bits += view.getUint8(p++) * 2 ** available;
+            available += 8;
+          }
+          const z = bits % 2 ** widths[f];
+          bits = Math.floor(bits / 2 ** widths[f]);
+          available -= widths[f];
+          if (f === 0) {
+            delta += unzigzag(z);
+            ts += delta;
+          } else {
+            values[f - 1] = (values[f - 1] + unzigzag(z)) & 0xFFFF;
+          }
+        }
+        emit();
+      }
+      off = start + payload;
+    }
+    return rows;
+  }
+
+  // older firmware wrote one JSON object per line
+  function decodeJsonLines(text) {
+    const rows = [];
+    for (let line of text.trim().split("\n")) {
+      try {
+        rows.push(JSON.parse(line));
+      } catch (e) {
+        console.warn("Skipping invalid JSON line:", line);
+      }
+    }
+    return rows;
+  }
+
   function loadFile() {
     if (!chart) {
       alert('Chart not initialized yet.');
@@ -109,38 +239,97 @@ const char GRAPH_HTML[] PROGMEM = R"rawliteral(
       return;
     }
 
+    const binary = path.endsWith(".bin");
     fetch("/api/file" + path)
       .then(res => {
         if (!res.ok) throw new Error("Failed to load file");
-        return res.text();
+        return binary ? res.arrayBuffer() : res.text();
+      })
+      .then(body => plotRows(binary ? decodeSampleLog(body) : decodeJsonLines(body)))
+      .catch(err => {
+        alert("Error loading file: " + err.message);
+      });
+  }
+
+  // any span: the device picks raw samples or a rollup so about one point per pixel comes back, see
+  // src/service/sensorlog/SeriesQuery.h. Each point is drawn at its mean, a step without a point had no data
+  function loadRange() {
+    const from = Date.parse(document.getElementById('fromInput').value) / 1000;
+    const to = Date.parse(document.getElementById('toInput').value) / 1000;
+    if (!(from < to)) {
+      alert("Enter a start before the end.");
+      return;
+    }
+    const maxPoints = Math.min(2000, document.getElementById('chart').clientWidth || 500);
+    fetch(`/api/series?from=${Math.floor(from)}&to=${Math.ceil(to)}&maxPoints=${maxPoints}`)
+      .then(res => {
+        if (!res.ok) throw new Error("Failed to load range");
+        return res.json();
       })
-      .then(text => {
-        const lines = text.trim().split("\n");
-        const labels = [], adc4 = [], adc5 = [], adc6 = [];
-
-        for (let line of lines) {
-          try {
-            const obj = JSON.parse(line);
-            if (!obj.timestamp) continue;
-            labels.push(new Date(obj.timestamp * 1000));
-            adc4.push(obj.ADC4 ?? null);
-            adc5.push(obj.ADC5 ?? null);
-            adc6.push(obj.ADC6 ?? null);
-          } catch (e) {
-            console.warn("Skipping invalid JSON line:", line);
+      .then(series => {
+        const rows = [];
+        let last = null;
+        for (const point of series.points) {
+          if (last !== null && point[0] - last > series.step + series.holdS) {
+            const empty = { timestamp: last + series.step };
+            for (const name of series.channels) empty[name] = null;
+            rows.push(empty);
           }
+          const row = { timestamp: point[0] };
+          series.channels.forEach((name, i) => row[name] = point[4 + 3 * i]);
+          rows.push(row);
+          last = point[0];
         }
-
-        chart.data.labels = labels;
-        chart.data.datasets[0].data = adc4;
-        chart.data.datasets[1].data = adc5;
-        chart.data.datasets[2].data = adc6;
-        chart.update();
+        plotRows(rows);
       })
       .catch(err => {
-        alert("Error loading file: " + err.message);
+        alert("Error loading range: " + err.message);
       });
   }
+
+  // samples as the device takes them, from its memory: no log download and no card access.
+  // EventSource reconnects by itself when the device drops a connection that fell behind
+  const LIVE_ROWS = 2700;  // an hour at the default period
+  let live = null;
+  function toggleLive() {
+    const button = document.getElementById('liveButton');
+    if (live) {
+      live.close();
+      live = null;
+      button.textContent = 'Live';
+      return;
+    }
+    let names = [];
+    const rows = [];
+    live = new EventSource('/api/live');
+    live.addEventListener('channels', e => { names = e.data.split(','); });
+    live.onmessage = e => {
+      const values = e.data.split(',').map(Number);
+      const row = { timestamp: values[0] };
+      names.forEach((name, i) => row[name] = values[i + 1]);
+      rows.push(row);
+      if (rows.length > LIVE_ROWS) rows.shift();
+      plotRows(rows);
+    };
+    button.textContent = 'Stop live';
+  }
+
+  // one line per channel the rows have, named by the log header (or the JSON keys of older logs)
+  function plotRows(rows) {
+    const labels = [], series = {};
+    for (let obj of rows) {
+      if (!obj.timestamp) continue;
+      for (const name of Object.keys(obj))
+        if (name !== 'timestamp' && !(name in series)) series[name] = new Array(labels.length).fill(null);
+      labels.push(new Date(obj.timestamp * 1000));
+      for (const name in series) series[name].push(obj[name] ?? null);
+    }
+
+    chart.data.labels = labels;
+    chart.data.datasets = Object.keys(series).map((name, i) => (
+      { label: name, borderColor: COLORS[i % COLORS.length], data: series[name], fill: false }));
+    chart.update();
+  }
 </script>
 </body>
 </html>
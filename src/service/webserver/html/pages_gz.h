@@ -0,0 +1,618 @@
+// Generated by tools/build_html.py from the *_html.h pages next to it: minified and gzipped, served with
+// Content-Encoding: gzip. Do not edit, change the page and run python3 tools/build_html.py
+#ifndef PAGES_GZ_H
+#define PAGES_GZ_H
+
+#include <Arduino.h>
+
+struct StaticPage {
+    const uint8_t* gz;
+    size_t length;
+    const char* etag;  // hash of the gzip, changes with the page and nothing else
+};
+
+// editor_html.h: 6971 bytes, 2082 gzipped
+static const uint8_t EDITOR_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x58, 0xfd, 0x6e, 0xdc, 0xb8,
+    0x11, 0xff, 0x5f, 0x4f, 0x41, 0x2b, 0x6d, 0xbc, 0x7b, 0xd9, 0x95, 0xec, 0x8d, 0x03, 0x14, 0xbb,
+    0xde, 0x0d, 0x70, 0x3e, 0x07, 0xbd, 0x5e, 0xee, 0x62, 0xf4, 0x9c, 0x16, 0x87, 0x5e, 0x81, 0xe3,
+    0x4a, 0xd4, 0x2e, 0x63, 0x8a, 0x14, 0x48, 0xca, 0xf6, 0x9e, 0xcf, 0xaf, 0xd1, 0x47, 0xe9, 0x5f,
+    0x7d, 0x9a, 0x3e, 0x49, 0x67, 0x48, 0xea, 0x63, 0x3f, 0xec, 0xa4, 0x40, 0x51, 0x04, 0x59, 0x49,
+    0xd4, 0x70, 0x38, 0xf3, 0x9b, 0xdf, 0x7c, 0xc8, 0xe7, 0x47, 0xdf, 0x7c, 0xb8, 0xb8, 0xfe, 0xe9,
+    0xea, 0x92, 0xac, 0x6d, 0x29, 0x16, 0xd1, 0x79, 0x73, 0x61, 0x34, 0x87, 0x8b, 0xe5, 0x56, 0xb0,
+    0xc5, 0x65, 0xce, 0xad, 0xd2, 0xe7, 0xa9, 0x7f, 0x8a, 0xce, 0x4b, 0x66, 0x29, 0xc9, 0xd6, 0x54,
+    0x1b, 0x66, 0xe7, 0xf1, 0xc7, 0xeb, 0x77, 0xe3, 0x3f, 0xc4, 0x24, 0x85, 0x17, 0xc6, 0x6e, 0x50,
+    0x00, 0x75, 0x8c, 0xc8, 0x52, 0xe5, 0x1b, 0xf2, 0x10, 0x95, 0x54, 0xaf, 0xb8, 0x9c, 0x92, 0x93,
+    0x59, 0x54, 0xd1, 0x3c, 0xe7, 0x72, 0xe5, 0xee, 0xef, 0x78, 0x6e, 0xd7, 0x53, 0x72, 0x7a, 0x72,
+    0xf2, 0xfb, 0x59, 0xb4, 0x66, 0x7c, 0xb5, 0xb6, 0xcd, 0x53, 0xce, 0x4d, 0x25, 0xe8, 0x66, 0x4a,
+    0x0a, 0xc1, 0xee, 0x67, 0x11, 0xfe, 0x8e, 0x73, 0xae, 0x59, 0x66, 0xb9, 0x02, 0x45, 0x5a, 0xdd,
+    0xcd, 0x22, 0x75, 0xcb, 0x74, 0x21, 0xd4, 0xdd, 0x94, 0xac, 0x79, 0x9e, 0x33, 0x09, 0x62, 0x4a,
+    0xda, 0x71, 0x41, 0x4b, 0x2e, 0x60, 0xa7, 0xa1, 0xd2, 0x8c, 0x0d, 0xd3, 0xbc, 0x98, 0x45, 0x4b,
+    0x9a, 0xdd, 0xac, 0xb4, 0xaa, 0x65, 0x3e, 0x25, 0x2f, 0x4e, 0x29, 0xfe, 0x9b, 0x45, 0x99, 0x12,
+    0x4a, 0xc3, 0x73, 0x96, 0x65, 0xb3, 0xe8, 0x31, 0x4a, 0x98, 0x73, 0x71, 0x6c, 0x78, 0xce, 0x96,
+    0x54, 0x83, 0xd9, 0x7d, 0xfb, 0x48, 0xfa, 0x15, 0x79, 0xc7, 0x85, 0x20, 0x15, 0xd5, 0x4c, 0x5a,
+    0xb8, 0x48, 0x26, 0x88, 0x93, 0x20, 0x5f, 0xa5, 0xe0, 0xe1, 0xfd, 0x38, 0x88, 0xbf, 0x3e, 0x39,
+    0xa9, 0xee, 0x9d, 0xfc, 0x87, 0x0a, 0xad, 0xa5, 0x82, 0xc0, 0xdb, 0x4e, 0x74, 0xdb, 0x96, 0xd3,
+    0xd3, 0xce, 0x91, 0x31, 0x58, 0x4d, 0x6b, 0xab, 0x7a, 0x28, 0x9d, 0x6a, 0x56, 0x82, 0xf9, 0xea,
+    0x1e, 0xcc, 0xfa, 0xd5, 0xad, 0x2c, 0x95, 0xce, 0x99, 0x1e, 0xc3, 0x12, 0xae, 0xbb, 0x7b, 0xed,
+    0x91, 0x9b, 0x54, 0xf7, 0xc4, 0x28, 0xc1, 0x73, 0xf2, 0xe2, 0xf5, 0xeb, 0xd7, 0xce, 0x82, 0x5b,
+    0x6e, 0x6a, 0x38, 0x9f, 0xc2, 0x1a, 0x9c, 0xbc, 0x05, 0x31, 0xbe, 0x2e, 0xb8, 0x6d, 0xfc, 0x81,
+    0xd7, 0xb0, 0x00, 0xa7, 0x81, 0x31, 0x39, 0x29, 0xb9, 0x1c, 0xb7, 0x06, 0xef, 0x43, 0xb3, 0x9e,
+    0xb4, 0x41, 0x1d, 0x5b, 0x55, 0xb9, 0x60, 0x3a, 0xec, 0xc1, 0x48, 0x06, 0xfa, 0x13, 0x6f, 0x76,
+    0x03, 0x30, 0x63, 0xac, 0x0f, 0x70, 0x49, 0x61, 0x9b, 0xc7, 0xef, 0xc1, 0x47, 0x16, 0xe0, 0x80,
+    0x28, 0x9e, 0x7e, 0x36, 0xec, 0xa0, 0xb0, 0x2e, 0xe5, 0x4e, 0x38, 0x27, 0x93, 0xc9, 0x2e, 0x7b,
+    0x5a, 0xf3, 0x9d, 0x65, 0x01, 0x25, 0xc1, 0x8a, 0x2f, 0x01, 0xa9, 0xb3, 0x13, 0x3c, 0xf3, 0x3c,
+    0xe8, 0x38, 0x9b, 0xbc, 0x01, 0xc7, 0x42, 0x50, 0xfa, 0x0e, 0x6f, 0xb9, 0x4b, 0x29, 0x6d, 0x0f,
+    0x5d, 0x2a, 0x6b, 0x55, 0x09, 0x12, 0xdb, 0xc7, 0x46, 0x35, 0x10, 0x13, 0xc8, 0x29, 0xc0, 0xb3,
+    0x29, 0x91, 0x4a, 0x02, 0x40, 0x77, 0x6b, 0x6e, 0xd9, 0xd8, 0x54, 0x34, 0x63, 0xb8, 0x74, 0xa7,
+    0x69, 0x75, 0x88, 0xe3, 0x96, 0xdd, 0xdb, 0x71, 0xb7, 0xcc, 0x84, 0xe0, 0x95, 0xe1, 0x26, 0x80,
+    0x65, 0xd6, 0x9a, 0xcb, 0x1b, 0xe7, 0xf6, 0x63, 0xf4, 0x22, 0x38, 0x02, 0x11, 0xa6, 0x7b, 0x50,
+    0xef, 0x23, 0xd6, 0xac, 0x9c, 0xf4, 0x83, 0x45, 0x1d, 0xf4, 0x66, 0x1f, 0x85, 0x43, 0x51, 0x08,
+    0x4e, 0x3b, 0x4a, 0xec, 0x7a, 0xbc, 0x6f, 0xde, 0xee, 0x11, 0xcb, 0x1a, 0xb0, 0x92, 0x70, 0xd2,
+    0x96, 0xe2, 0xb3, 0xb3, 0xb3, 0x1d, 0x26, 0xf9, 0x53, 0x1a, 0xd8, 0x0e, 0x07, 0x27, 0x90, 0x33,
+    0x64, 0x46, 0x63, 0x71, 0x56, 0x6b, 0x83, 0x7a, 0x2a, 0xc5, 0xa5, 0x65, 0x1a, 0xc0, 0xd4, 0x50,
+    0x24, 0xb8, 0x27, 0x57, 0x77, 0x2a, 0xc8, 0x4f, 0xcc, 0xd3, 0x16, 0x4e, 0xd7, 0x08, 0xff, 0xae,
+    0x9d, 0x6f, 0xde, 0xbc, 0xc1, 0x2d, 0x35, 0x92, 0x5a, 0x70, 0x03, 0xd4, 0xc0, 0x42, 0x38, 0xb6,
+    0x9b, 0x8a, 0xed, 0x98, 0x1a, 0x98, 0xd8, 0x37, 0xb4, 0x41, 0xa4, 0x50, 0x02, 0x5c, 0x23, 0x0b,
+    0x02, 0x34, 0x90, 0xd3, 0xe9, 0x92, 0x15, 0x4a, 0x33, 0x50, 0x98, 0x01, 0xd7, 0x20, 0x4b, 0xa7,
+    0xe4, 0xf8, 0xdf, 0xff, 0xf8, 0xe7, 0x71, 0x2f, 0x4f, 0xb8, 0x14, 0x5c, 0xb2, 0xf1, 0x52, 0xa8,
+    0xec, 0xa6, 0x2b, 0xa8, 0x07, 0x7d, 0x3d, 0x40, 0xb9, 0xf6, 0xc4, 0x44, 0x55, 0x4c, 0x3e, 0x7f,
+    0xec, 0xbf, 0x8e, 0x51, 0x5e, 0x70, 0x27, 0x83, 0xef, 0xbe, 0x48, 0x7f, 0x90, 0x6f, 0x21, 0x6b,
+    0x02, 0x59, 0x14, 0x45, 0xa0, 0x72, 0xce, 0x32, 0xa5, 0xa9, 0x0f, 0x01, 0x20, 0xc9, 0x34, 0x3a,
+    0xe4, 0x4d, 0xe3, 0x82, 0x75, 0x75, 0x26, 0x80, 0x96, 0x4c, 0xd0, 0xb9, 0xc7, 0xe8, 0x3c, 0x0d,
+    0x8d, 0xe6, 0x3c, 0x0d, 0x7d, 0x0a, 0x7b, 0x0d, 0x5c, 0x72, 0x7e, 0x4b, 0x32, 0x41, 0x8d, 0x99,
+    0xc7, 0xdb, 0x55, 0x2b, 0xc6, 0x96, 0x36, 0x59, 0x40, 0x11, 0x67, 0x06, 0x36, 0x4d, 0xe0, 0x11,
+    0x82, 0xc5, 0xf3, 0x79, 0x8c, 0x07, 0x5d, 0x6b, 0xc6, 0xe2, 0xc5, 0x79, 0x5a, 0x63, 0xe7, 0x4b,
+    0x41, 0xc9, 0x41, 0x55, 0x5d, 0xe9, 0x8a, 0x0f, 0xbe, 0xf7, 0x25, 0x23, 0x6e, 0xb5, 0x4a, 0x5a,
+    0xb2, 0xaf, 0xf1, 0xe8, 0x1f, 0x14, 0x71, 0xee, 0x78, 0x7c, 0x58, 0xde, 0x3f, 0x02, 0x85, 0x7b,
+    0x99, 0x8a, 0x56, 0x3c, 0x75, 0x7e, 0x20, 0x22, 0x1e, 0x1e, 0xb2, 0x45, 0xc9, 0x4c, 0xf0, 0xec,
+    0x66, 0x1e, 0x1b, 0x7a, 0xcb, 0xd0, 0xb7, 0xc1, 0x30, 0x5e, 0xfc, 0x08, 0xf7, 0xe7, 0xa9, 0x97,
+    0xe8, 0xdc, 0x09, 0x17, 0x93, 0x69, 0x5e, 0x59, 0x62, 0x74, 0x36, 0x8f, 0xd7, 0xd6, 0x56, 0x66,
+    0x9a, 0xa6, 0x59, 0x2e, 0x3f, 0x99, 0x24, 0x13, 0xaa, 0xce, 0x0b, 0x01, 0x46, 0x24, 0x99, 0x2a,
+    0x53, 0xfa, 0x89, 0xde, 0xa7, 0x82, 0x2f, 0x4d, 0x0a, 0x25, 0x29, 0x3d, 0x4d, 0xce, 0x92, 0xd3,
+    0x33, 0xbc, 0x4d, 0x3e, 0x19, 0xb4, 0xd1, 0xeb, 0x69, 0x15, 0x2e, 0x90, 0x2d, 0xc6, 0x12, 0x6f,
+    0x29, 0x99, 0x13, 0x94, 0xc4, 0x87, 0xc1, 0x96, 0x73, 0xc3, 0x59, 0xe4, 0x1f, 0x13, 0x18, 0x1c,
+    0xae, 0xd7, 0xac, 0x64, 0x83, 0x18, 0xd5, 0x5b, 0xbc, 0x4d, 0x4b, 0x25, 0xd5, 0x0d, 0xe5, 0x5b,
+    0x52, 0xc6, 0x80, 0xcb, 0x28, 0xfd, 0xbd, 0xca, 0x83, 0x70, 0x09, 0x77, 0xe9, 0x27, 0xa3, 0x24,
+    0x0a, 0x0a, 0x66, 0x09, 0x90, 0x11, 0xbb, 0x18, 0xfa, 0x0f, 0x27, 0xc7, 0xb1, 0x5f, 0x05, 0xe8,
+    0xec, 0x85, 0xa7, 0x70, 0x58, 0xa5, 0x66, 0x23, 0x33, 0x52, 0xd4, 0xd2, 0xe1, 0x48, 0x0a, 0x66,
+    0xb3, 0x35, 0x46, 0x7e, 0x50, 0x51, 0xbb, 0x1e, 0x11, 0x55, 0x14, 0x70, 0xce, 0xd0, 0x33, 0x1f,
+    0x7c, 0xd1, 0xcc, 0xa0, 0x23, 0x77, 0x14, 0xfa, 0xa4, 0x93, 0x1d, 0xfc, 0x92, 0xd2, 0x8a, 0xa7,
+    0x16, 0xb6, 0xa4, 0x6f, 0x71, 0xcf, 0xfc, 0x77, 0x0f, 0x4c, 0x66, 0x60, 0xce, 0xc7, 0x3f, 0x7f,
+    0x7b, 0xa1, 0xca, 0x0a, 0x68, 0x2f, 0xad, 0xd3, 0x36, 0x7c, 0x7c, 0xe9, 0xd5, 0x81, 0x88, 0xbf,
+    0x79, 0xfc, 0x05, 0xac, 0xe5, 0x05, 0x19, 0x1c, 0x81, 0xde, 0x44, 0xdd, 0x0c, 0x89, 0x5d, 0x43,
+    0x35, 0x26, 0x92, 0xdd, 0x91, 0x4b, 0xad, 0x95, 0x1e, 0xc4, 0xef, 0x28, 0x78, 0x90, 0x13, 0xab,
+    0x08, 0x96, 0x10, 0x12, 0x93, 0x57, 0xc4, 0xe9, 0x9a, 0x45, 0x9a, 0xd9, 0x5a, 0x4b, 0xb4, 0x28,
+    0x41, 0xc7, 0x07, 0x43, 0x4c, 0x82, 0xd6, 0x91, 0x6c, 0xcd, 0x45, 0x7e, 0x05, 0x92, 0x03, 0xe8,
+    0x96, 0x23, 0x82, 0xb4, 0x43, 0x2f, 0xc2, 0x26, 0x5c, 0x4c, 0x98, 0xcc, 0xcd, 0x5f, 0x39, 0x48,
+    0x1c, 0xa7, 0xc7, 0x43, 0xf2, 0x96, 0xc0, 0x1a, 0x99, 0xba, 0xdf, 0x57, 0xc4, 0x2d, 0xbd, 0x72,
+    0xdb, 0x50, 0xed, 0x0e, 0x4a, 0x42, 0xd1, 0xdc, 0x81, 0xd4, 0x01, 0x83, 0x00, 0x6c, 0x23, 0xe3,
+    0x04, 0x40, 0xcf, 0x88, 0x9c, 0x0c, 0x67, 0x0d, 0x7c, 0x4a, 0x21, 0xf0, 0xb9, 0xca, 0xea, 0x12,
+    0x60, 0x49, 0x56, 0xcc, 0x5e, 0x0a, 0x86, 0xb7, 0x5f, 0x6f, 0xbe, 0xcd, 0x07, 0x5d, 0xde, 0xa1,
+    0x7f, 0x20, 0x9b, 0x70, 0x29, 0x99, 0xfe, 0xe3, 0xf5, 0xf7, 0xef, 0x61, 0xd7, 0xf1, 0x31, 0x3a,
+    0x8d, 0x05, 0xe1, 0x02, 0x9d, 0x83, 0xdb, 0x01, 0x9e, 0x3a, 0x72, 0x5a, 0x47, 0xce, 0x82, 0x24,
+    0x60, 0xd3, 0x03, 0x62, 0x67, 0x87, 0x84, 0xc8, 0x8c, 0x48, 0x0d, 0x93, 0xa8, 0x13, 0x05, 0xfb,
+    0xdd, 0x52, 0x92, 0x05, 0x01, 0xf2, 0xdb, 0x6f, 0xe4, 0x6f, 0x7f, 0x1f, 0x42, 0x15, 0xd4, 0x97,
+    0x14, 0xc2, 0xeb, 0xd6, 0xc9, 0x7c, 0x11, 0xf4, 0x38, 0xa7, 0xdc, 0x9a, 0x57, 0xd2, 0xc1, 0xec,
+    0xf9, 0xe2, 0x9e, 0x13, 0x87, 0xf6, 0x30, 0xc4, 0xd6, 0xa9, 0x97, 0x50, 0xd8, 0xc8, 0x7c, 0x3e,
+    0x77, 0x05, 0xad, 0x80, 0x7a, 0x96, 0x0f, 0x89, 0x8f, 0x45, 0x03, 0x0d, 0xd4, 0xc5, 0x1e, 0x30,
+    0x19, 0x64, 0x86, 0x65, 0x01, 0x9b, 0x41, 0x2c, 0x5c, 0x02, 0x04, 0x41, 0xba, 0x84, 0x39, 0xe9,
+    0x69, 0x59, 0xac, 0xae, 0x2e, 0x0b, 0x50, 0x2e, 0xc1, 0x8a, 0xda, 0x63, 0x7c, 0x09, 0x65, 0x3c,
+    0x49, 0x12, 0x4c, 0x07, 0x9e, 0xd0, 0x0a, 0x6a, 0x7c, 0xee, 0xa0, 0x19, 0x38, 0xe9, 0x76, 0x17,
+    0xb4, 0xa5, 0xcb, 0x5b, 0xd8, 0xf2, 0x1e, 0x38, 0xc7, 0x20, 0x02, 0x83, 0xd8, 0xd5, 0x94, 0x78,
+    0xd4, 0x72, 0x60, 0xe0, 0xe8, 0xc4, 0x12, 0x03, 0x05, 0xee, 0x4a, 0xab, 0x8a, 0xae, 0x5c, 0xc5,
+    0x46, 0x16, 0x82, 0x66, 0x3f, 0x35, 0xe2, 0xc3, 0x6e, 0x42, 0xb5, 0x68, 0x0c, 0x13, 0x48, 0x70,
+    0x09, 0xab, 0x2b, 0xd6, 0xc1, 0xdb, 0x86, 0x09, 0x97, 0x7b, 0x61, 0xc2, 0x90, 0xc2, 0xff, 0x5a,
+    0x6c, 0xdb, 0xcc, 0x0f, 0x85, 0xda, 0x1d, 0xe6, 0xc3, 0xec, 0x27, 0x59, 0x34, 0x5a, 0x88, 0xab,
+    0x10, 0xee, 0xff, 0x23, 0xda, 0xde, 0x57, 0x97, 0x42, 0x2d, 0x11, 0xb0, 0xfb, 0x3b, 0x22, 0xc4,
+    0x7e, 0x8a, 0x55, 0x7a, 0x13, 0x0f, 0xdd, 0x80, 0x90, 0xb8, 0xc2, 0x8e, 0x88, 0x23, 0xfc, 0x90,
+    0x0b, 0xae, 0x0f, 0xc7, 0xc3, 0x27, 0x43, 0xe5, 0x0d, 0xac, 0x9f, 0xb3, 0xae, 0x16, 0xb1, 0x87,
+    0xcd, 0xb5, 0xc6, 0x24, 0x0c, 0x09, 0x48, 0x04, 0x6c, 0xc7, 0xfb, 0x2c, 0xa8, 0x45, 0x28, 0x9f,
+    0x58, 0x6c, 0xa0, 0xec, 0xcc, 0xc9, 0xd1, 0xd1, 0x56, 0x7a, 0xfc, 0x4f, 0x08, 0xe2, 0x0d, 0x77,
+    0x03, 0x06, 0x24, 0xc4, 0x9e, 0x71, 0x08, 0x8e, 0x1b, 0x5f, 0xe2, 0x83, 0xa6, 0xbb, 0x7d, 0x6f,
+    0x83, 0x07, 0x50, 0xb0, 0x5a, 0xd9, 0x2d, 0x08, 0xad, 0x5a, 0xad, 0xa0, 0xf5, 0xc5, 0x28, 0x0d,
+    0x56, 0x1d, 0xe1, 0xb5, 0x29, 0xb6, 0x4e, 0xc3, 0xcb, 0x97, 0xe4, 0xc8, 0x7b, 0x39, 0x0c, 0xf3,
+    0x99, 0xf3, 0xd7, 0xea, 0x9a, 0xf5, 0x59, 0xdb, 0x50, 0x07, 0xab, 0xd8, 0x17, 0x32, 0xb6, 0x65,
+    0x9b, 0x63, 0xe7, 0x63, 0xbf, 0x0c, 0x34, 0x30, 0x0e, 0x9f, 0x2e, 0x4b, 0xed, 0x6e, 0xd8, 0x0c,
+    0xb3, 0xbc, 0x61, 0x87, 0xc9, 0x01, 0x85, 0xf2, 0x19, 0x6a, 0x7c, 0x2e, 0x48, 0x50, 0xb8, 0xc1,
+    0x03, 0x25, 0xb1, 0x3d, 0x5e, 0xe0, 0xda, 0x60, 0xdb, 0x68, 0x9f, 0x38, 0xcf, 0x26, 0x5b, 0x7f,
+    0x73, 0x53, 0x4a, 0xd1, 0xcf, 0x7e, 0xe3, 0x05, 0x8c, 0x43, 0xd3, 0x86, 0x42, 0xff, 0x17, 0x2a,
+    0x6a, 0xec, 0x18, 0x47, 0x10, 0xdf, 0x5e, 0x1f, 0xee, 0x72, 0x12, 0x7e, 0x0b, 0xae, 0xcb, 0x8b,
+    0x35, 0x95, 0x88, 0x70, 0xf3, 0x3c, 0x88, 0x7f, 0x52, 0x35, 0x59, 0xc3, 0x00, 0x03, 0xc5, 0x13,
+    0x67, 0x9a, 0x1c, 0xff, 0xca, 0x00, 0x22, 0x26, 0xf9, 0x59, 0xfe, 0x2c, 0xaf, 0xa0, 0x01, 0x1a,
+    0xf2, 0xe1, 0x3b, 0x6c, 0x91, 0x40, 0x92, 0x8c, 0x6a, 0xe8, 0x96, 0x30, 0x3a, 0x24, 0xcd, 0xab,
+    0x0b, 0x2a, 0x33, 0x48, 0x61, 0x78, 0x7d, 0xc3, 0x58, 0xe5, 0x0c, 0x82, 0x91, 0x3b, 0x89, 0x1b,
+    0x36, 0x6c, 0x1d, 0xdb, 0x55, 0x65, 0x98, 0x54, 0xa1, 0xcb, 0xb9, 0xf9, 0x69, 0xbf, 0xa9, 0x6c,
+    0xbf, 0xc2, 0x2f, 0x29, 0x37, 0x0b, 0xc4, 0x6e, 0x16, 0x70, 0xb1, 0x69, 0xfa, 0x74, 0xe4, 0x49,
+    0xe3, 0xe6, 0x86, 0x45, 0x80, 0xe8, 0xe9, 0x6e, 0xff, 0x1e, 0xf4, 0x92, 0xc2, 0xb5, 0xfc, 0x78,
+    0xbb, 0xc5, 0x63, 0x65, 0x71, 0x2d, 0xbe, 0xd1, 0x68, 0x5d, 0x47, 0x59, 0xf8, 0xb9, 0xbb, 0x37,
+    0xea, 0xe0, 0xa9, 0x48, 0x80, 0xfe, 0xa0, 0x83, 0xb2, 0xf0, 0x89, 0xf0, 0x5c, 0xd7, 0x6d, 0xe6,
+    0xd2, 0xe1, 0x4e, 0x0d, 0xf3, 0xea, 0xac, 0xde, 0xb4, 0x61, 0xc2, 0x61, 0x03, 0x5e, 0xfc, 0xe9,
+    0xc7, 0x0f, 0x3f, 0x40, 0xbb, 0xd5, 0x86, 0x39, 0x53, 0xfe, 0x9b, 0xf9, 0xac, 0x1b, 0xf7, 0x3c,
+    0x27, 0x9c, 0x2a, 0x63, 0xe1, 0x43, 0x70, 0xc5, 0x8b, 0xcd, 0x00, 0xc5, 0xa0, 0x51, 0x00, 0x21,
+    0x47, 0x64, 0x32, 0x1c, 0x91, 0xf1, 0xa9, 0xcb, 0x85, 0x8c, 0x02, 0xc4, 0x58, 0x52, 0x3e, 0x77,
+    0x0c, 0x9a, 0x73, 0xe8, 0x18, 0x5c, 0x6f, 0xb4, 0x39, 0x1c, 0x9d, 0xc6, 0x01, 0xd3, 0xda, 0xe3,
+    0x48, 0x05, 0xd3, 0x50, 0x33, 0x5d, 0x28, 0x5c, 0x84, 0xc1, 0x1e, 0x37, 0xa3, 0x4f, 0xdd, 0xd8,
+    0x05, 0x72, 0x49, 0x09, 0x87, 0x42, 0x9e, 0x87, 0x76, 0xd4, 0x23, 0x44, 0x37, 0x6b, 0x37, 0x31,
+    0xee, 0x45, 0x65, 0xd8, 0x29, 0xdf, 0x9d, 0xfa, 0x93, 0x2e, 0xcc, 0xa8, 0xaf, 0x4d, 0x84, 0x80,
+    0xfe, 0x5e, 0xf6, 0xcc, 0x0e, 0x32, 0xad, 0x77, 0xd6, 0x08, 0xbf, 0x8f, 0x98, 0x5d, 0x2b, 0xf8,
+    0x02, 0x8d, 0xaf, 0x3e, 0x5e, 0xc7, 0xa3, 0x08, 0xbf, 0x86, 0x98, 0x36, 0x53, 0xf2, 0x40, 0xe2,
+    0x10, 0xd8, 0xf1, 0x35, 0xb4, 0xa1, 0x18, 0x24, 0x20, 0xc3, 0x21, 0x83, 0x5d, 0x65, 0xf6, 0xe1,
+    0x21, 0x8f, 0xa3, 0x08, 0xbf, 0x9b, 0xa6, 0x64, 0x27, 0x2a, 0x0f, 0xa4, 0xfd, 0xf6, 0x6b, 0xec,
+    0x03, 0x0c, 0x1f, 0x0f, 0x12, 0xbc, 0xe1, 0xf7, 0xc3, 0x0e, 0x0f, 0xc3, 0xc6, 0x59, 0x83, 0x06,
+    0x7e, 0x95, 0x78, 0x08, 0xda, 0x52, 0xb7, 0x47, 0xf9, 0x5d, 0xb6, 0xef, 0xe6, 0x4c, 0x20, 0xdf,
+    0xe3, 0x67, 0xa2, 0x8a, 0x47, 0x85, 0xcc, 0x7a, 0x3a, 0x9c, 0xdd, 0x5c, 0x3b, 0x8b, 0x7a, 0x9f,
+    0x33, 0x69, 0xf8, 0x90, 0x4c, 0xfd, 0x9f, 0x41, 0xff, 0x03, 0xc6, 0x01, 0xf8, 0xa1, 0x1e, 0x15,
+    0x00, 0x00,
+};
+static const StaticPage EDITOR_HTML_PAGE = {EDITOR_HTML_GZ, sizeof(EDITOR_HTML_GZ), "\"d7c4ad9c3620aeb9\""};
+
+// filebrowser_html.h: 4435 bytes, 1313 gzipped
+static const uint8_t FILEBROWSER_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x57, 0xff, 0x6e, 0xdb, 0x36,
+    0x10, 0xfe, 0x5f, 0x4f, 0xc1, 0xb8, 0x43, 0x24, 0xa1, 0x96, 0x9c, 0x1a, 0x29, 0x30, 0xf8, 0x47,
+    0x02, 0x34, 0x4b, 0xd0, 0x02, 0x1d, 0x16, 0x14, 0x29, 0x86, 0x61, 0x18, 0x50, 0x5a, 0x3a, 0x59,
+    0x6c, 0x28, 0x52, 0xa0, 0xa8, 0xa4, 0x5e, 0xeb, 0xd7, 0xd8, 0xa3, 0xec, 0xaf, 0x3d, 0xcd, 0x9e,
+    0x64, 0x77, 0xa4, 0xe4, 0x5f, 0x69, 0x83, 0x6d, 0xe8, 0x30, 0x04, 0xb1, 0x24, 0xfa, 0xee, 0x78,
+    0xf7, 0x7d, 0xdf, 0x1d, 0xe5, 0xd9, 0xd1, 0x77, 0x3f, 0x5c, 0xdc, 0xfc, 0x74, 0x7d, 0xc9, 0x4a,
+    0x5b, 0xc9, 0xb3, 0x60, 0xd6, 0x5f, 0x80, 0xe7, 0x78, 0xa9, 0xc0, 0x72, 0x96, 0x95, 0xdc, 0x34,
+    0x60, 0xe7, 0x83, 0xb7, 0x37, 0x57, 0xc9, 0xb7, 0x03, 0x5c, 0xb6, 0xc2, 0x4a, 0x38, 0xbb, 0x12,
+    0x12, 0xd8, 0x0b, 0xa3, 0xef, 0x1b, 0x30, 0xb3, 0x91, 0x5f, 0x0b, 0x66, 0x8d, 0x5d, 0xd1, 0x75,
+    0xa1, 0xf3, 0x15, 0xfb, 0x18, 0x54, 0xdc, 0x2c, 0x85, 0x9a, 0xb0, 0x93, 0x69, 0x50, 0x68, 0x65,
+    0x93, 0x82, 0x57, 0x42, 0xae, 0x26, 0xac, 0xe1, 0xaa, 0x49, 0xd0, 0x4f, 0x14, 0xd3, 0x60, 0xc1,
+    0xb3, 0xdb, 0xa5, 0xd1, 0xad, 0xca, 0x93, 0x4c, 0x4b, 0x6d, 0x26, 0xec, 0xc9, 0x33, 0x4e, 0x7f,
+    0xd3, 0xa0, 0x7f, 0xce, 0xb2, 0x6c, 0x1a, 0xe4, 0xa2, 0xa9, 0x25, 0x47, 0xe7, 0x42, 0xc2, 0x07,
+    0x8c, 0x87, 0x9f, 0x49, 0x2e, 0x0c, 0x64, 0x56, 0x68, 0xdc, 0x02, 0x6d, 0xdb, 0x4a, 0x4d, 0x83,
+    0x12, 0xc4, 0xb2, 0xb4, 0x13, 0xf6, 0xec, 0xe4, 0xe4, 0xae, 0x9c, 0x06, 0xfa, 0x0e, 0x4c, 0x21,
+    0xf5, 0xfd, 0x84, 0x95, 0x22, 0xcf, 0x01, 0x0d, 0xd6, 0x01, 0x55, 0x07, 0x06, 0xd3, 0xdb, 0x6e,
+    0x8d, 0x9b, 0x8c, 0xc7, 0xe3, 0x69, 0x50, 0xf3, 0x3c, 0x17, 0x6a, 0x89, 0xee, 0x06, 0xaa, 0x07,
+    0x7b, 0xbe, 0x6f, 0x1b, 0x2b, 0x8a, 0x15, 0xe6, 0xa9, 0x2c, 0x28, 0xdc, 0xa4, 0xa9, 0x79, 0x06,
+    0xc9, 0x02, 0xec, 0x3d, 0x50, 0x68, 0x2e, 0xc5, 0x52, 0x25, 0xc2, 0x42, 0xd5, 0x60, 0x42, 0x68,
+    0x01, 0x66, 0x67, 0xbf, 0x72, 0xfc, 0x19, 0x44, 0x1a, 0xf1, 0x2b, 0xe0, 0x6e, 0xe9, 0xd8, 0xed,
+    0xb7, 0x0e, 0x16, 0xad, 0xb5, 0x5a, 0x1d, 0xe6, 0x76, 0x7a, 0x7a, 0xba, 0x45, 0x03, 0x00, 0x10,
+    0x35, 0x6d, 0x30, 0xe6, 0x84, 0x29, 0xad, 0x60, 0x27, 0xed, 0x93, 0xf4, 0x39, 0x06, 0xea, 0xb2,
+    0xcf, 0x5a, 0xd3, 0x90, 0x47, 0xad, 0x45, 0x9f, 0xca, 0x93, 0x02, 0x59, 0xbb, 0x31, 0x00, 0xb8,
+    0x83, 0x14, 0x0d, 0xee, 0x4f, 0x7c, 0x25, 0x76, 0x55, 0xc3, 0x41, 0xac, 0x44, 0x42, 0x61, 0x7b,
+    0x1c, 0x76, 0xb2, 0xee, 0x01, 0x4d, 0x10, 0x15, 0xde, 0x5a, 0xed, 0x99, 0x40, 0xc3, 0x03, 0x8a,
+    0x2b, 0xad, 0xb4, 0x83, 0x67, 0xbf, 0xd0, 0xd3, 0xfa, 0x03, 0xe5, 0x21, 0x05, 0x61, 0xa7, 0x26,
+    0x25, 0x85, 0xc3, 0x5c, 0xfa, 0xda, 0x8a, 0x02, 0x15, 0x61, 0xe1, 0x83, 0x4d, 0x72, 0xc8, 0xb4,
+    0xe1, 0x9e, 0x5b, 0x04, 0x01, 0x8c, 0x14, 0x94, 0xdd, 0x3a, 0x48, 0x0b, 0x2d, 0xa9, 0xf4, 0xc9,
+    0x02, 0x0a, 0x6d, 0xc0, 0x39, 0x77, 0x74, 0x84, 0x7f, 0xfe, 0xf6, 0x7b, 0xb8, 0xc3, 0x9a, 0x50,
+    0xe4, 0x94, 0x2c, 0xa4, 0xce, 0x6e, 0xfb, 0x22, 0x12, 0xe3, 0xf5, 0xf1, 0xdc, 0x27, 0xd2, 0x45,
+    0x4b, 0x75, 0x0d, 0xea, 0x0b, 0x21, 0xff, 0x08, 0xbd, 0x21, 0xe9, 0xfd, 0xe3, 0x21, 0x3c, 0xe9,
+    0xd8, 0xf3, 0xe6, 0xbe, 0xf6, 0xe5, 0x0c, 0x59, 0x9f, 0xe2, 0xbf, 0xa8, 0xae, 0xe2, 0x42, 0x6d,
+    0x77, 0xe9, 0xf1, 0x7f, 0x04, 0xf4, 0x75, 0x30, 0x1b, 0x75, 0x4d, 0x37, 0x1b, 0x75, 0x7d, 0x4b,
+    0xdd, 0xd7, 0x75, 0x31, 0x18, 0xba, 0x19, 0x1f, 0x74, 0x2b, 0x2e, 0xa0, 0x95, 0x97, 0x9a, 0x56,
+    0x99, 0x14, 0xd9, 0xed, 0x7c, 0x20, 0x35, 0xcf, 0x49, 0x1a, 0x51, 0x3c, 0x38, 0x7b, 0x03, 0xf4,
+    0x34, 0x1b, 0x79, 0x9b, 0x3e, 0xb4, 0x0b, 0x46, 0x19, 0xe2, 0xa5, 0x95, 0x4c, 0xe4, 0xf3, 0x41,
+    0xaf, 0xa7, 0xc1, 0xd9, 0x6c, 0xd4, 0xd2, 0xe8, 0x18, 0x75, 0xdf, 0x37, 0x99, 0x11, 0xb5, 0x3d,
+    0x0b, 0x78, 0xb3, 0x52, 0x19, 0x2b, 0x5a, 0xe5, 0xfa, 0x94, 0x15, 0x60, 0xb3, 0xd2, 0xed, 0x52,
+    0x73, 0x5b, 0x0e, 0x99, 0x2e, 0x0a, 0x1c, 0x2e, 0xb1, 0x87, 0xbc, 0xb1, 0xcc, 0x40, 0xc3, 0xe6,
+    0x8c, 0xdf, 0x73, 0x61, 0xbd, 0x6d, 0xf4, 0x6e, 0xc4, 0x6b, 0x31, 0xb2, 0xe8, 0x32, 0x3a, 0x27,
+    0x9f, 0xf9, 0x37, 0x1f, 0x41, 0x65, 0x3a, 0x87, 0xb7, 0x6f, 0x5e, 0x5d, 0xe8, 0xaa, 0x46, 0xd1,
+    0x2a, 0xeb, 0xa2, 0xc5, 0xeb, 0x63, 0x1f, 0x0e, 0x4d, 0xfc, 0xcd, 0xfa, 0x5d, 0x3c, 0x0d, 0x44,
+    0xc1, 0xa2, 0x23, 0x8c, 0x9b, 0xea, 0xdb, 0x98, 0xd9, 0x12, 0x31, 0x60, 0x0a, 0xee, 0xd9, 0xa5,
+    0x31, 0xda, 0x44, 0x83, 0x2b, 0x8e, 0x15, 0xe4, 0xcc, 0x6a, 0x46, 0xfd, 0xc0, 0x06, 0xec, 0x29,
+    0x73, 0xb1, 0xa6, 0x81, 0x01, 0xdb, 0x1a, 0x45, 0x19, 0xa5, 0xef, 0x1b, 0xad, 0xa2, 0x98, 0xc0,
+    0xde, 0x14, 0x92, 0x95, 0x42, 0xe6, 0xd7, 0x68, 0x19, 0xe1, 0x10, 0x1a, 0x32, 0xc5, 0x2b, 0xa0,
+    0x2a, 0x3a, 0x27, 0x5a, 0x4c, 0x41, 0xe5, 0xcd, 0x8f, 0x02, 0x2d, 0xc2, 0x51, 0x18, 0xb3, 0x73,
+    0x86, 0x6b, 0x6c, 0xe2, 0x3e, 0x9f, 0x32, 0xb7, 0xf4, 0xd4, 0xb9, 0x51, 0xd8, 0x03, 0x94, 0xb6,
+    0x54, 0x60, 0x48, 0x6b, 0x56, 0x1b, 0x78, 0x08, 0x86, 0x7d, 0x7c, 0x9c, 0x19, 0x46, 0x1b, 0xb2,
+    0x93, 0x78, 0xda, 0x83, 0xa8, 0xb5, 0x45, 0xab, 0x5c, 0x67, 0x6d, 0x85, 0xe0, 0xa4, 0x4b, 0xb0,
+    0x97, 0x12, 0xe8, 0xf6, 0xc5, 0xea, 0x55, 0x1e, 0x85, 0x3d, 0x69, 0x21, 0x55, 0x89, 0xb6, 0xa9,
+    0x50, 0x0a, 0xcc, 0xcb, 0x9b, 0xef, 0x5f, 0xa3, 0x57, 0x18, 0x52, 0xe9, 0xa4, 0xc9, 0x0b, 0x2a,
+    0x11, 0x6f, 0x23, 0xda, 0x75, 0xe8, 0xa2, 0x0e, 0x5d, 0x06, 0x69, 0x87, 0xd0, 0x9a, 0x65, 0x1c,
+    0x53, 0x60, 0x11, 0xf4, 0x04, 0x6a, 0x09, 0x29, 0x3c, 0x00, 0x16, 0xab, 0x61, 0xae, 0x7d, 0xc8,
+    0x79, 0x32, 0x18, 0x32, 0x70, 0x58, 0xee, 0xa0, 0x79, 0xb0, 0xa1, 0x42, 0x7a, 0x87, 0xac, 0x95,
+    0x43, 0xcf, 0x05, 0x06, 0x77, 0x4b, 0x69, 0xd6, 0x19, 0xb0, 0x4f, 0x9f, 0xd8, 0xcf, 0xbf, 0xc4,
+    0xd8, 0x67, 0xe6, 0x92, 0xa3, 0x46, 0xdc, 0x3a, 0x9b, 0x9f, 0x75, 0x71, 0x1c, 0x26, 0x6e, 0xcd,
+    0x07, 0xd9, 0x72, 0xe5, 0x45, 0xe7, 0x9e, 0x53, 0x47, 0x59, 0xdc, 0x09, 0xc4, 0x85, 0x57, 0xd8,
+    0x9a, 0x6c, 0x3e, 0x9f, 0xbb, 0x96, 0x2c, 0xb0, 0x23, 0xf3, 0x98, 0x79, 0x42, 0x7b, 0x64, 0x71,
+    0x6e, 0xed, 0xe0, 0x9a, 0x19, 0xe0, 0x16, 0x3a, 0x68, 0xa3, 0x50, 0x8a, 0x70, 0x43, 0x81, 0xe4,
+    0x0b, 0x90, 0x8f, 0xd8, 0xd2, 0xf4, 0x23, 0x6b, 0x67, 0x97, 0xd2, 0x4c, 0xb8, 0xf0, 0x23, 0x87,
+    0x18, 0xa8, 0x70, 0x08, 0xa5, 0x69, 0x8a, 0x44, 0x48, 0x91, 0xf2, 0x1a, 0x47, 0x53, 0xee, 0xa0,
+    0x89, 0x9c, 0xf5, 0xc6, 0x0b, 0x67, 0xc4, 0xe5, 0x1d, 0xba, 0xbc, 0x46, 0xe1, 0x02, 0x12, 0x18,
+    0x85, 0xae, 0x93, 0x51, 0x0a, 0x3d, 0xae, 0x9e, 0x18, 0x48, 0x1b, 0xab, 0xeb, 0x6b, 0xa3, 0x6b,
+    0xbe, 0x74, 0x33, 0x87, 0xa4, 0x8c, 0x91, 0x71, 0xb4, 0xe0, 0x60, 0xa1, 0x87, 0xc3, 0xae, 0xdc,
+    0xa0, 0x11, 0x07, 0xa9, 0x2d, 0x91, 0x10, 0xf4, 0x84, 0x2d, 0xbe, 0x1b, 0x9e, 0x68, 0x79, 0x87,
+    0x27, 0xb4, 0x76, 0x82, 0x88, 0x50, 0x02, 0x64, 0xfd, 0x4f, 0x14, 0x61, 0x0c, 0x51, 0xb1, 0xc6,
+    0xff, 0x56, 0xee, 0xd7, 0x2c, 0xf6, 0x1b, 0x6f, 0x87, 0x62, 0x2f, 0x93, 0x9a, 0xe3, 0x92, 0xa5,
+    0xa2, 0xa5, 0xbc, 0xee, 0xe4, 0xe2, 0x7a, 0x9e, 0xbe, 0xfe, 0x5f, 0x08, 0xf4, 0xf0, 0xb9, 0xd6,
+    0xde, 0x68, 0x8b, 0x8e, 0x58, 0xa7, 0xad, 0xd0, 0xbf, 0xb4, 0x68, 0xb3, 0x0a, 0x63, 0x77, 0x0a,
+    0xa7, 0x99, 0xe4, 0x4d, 0x43, 0x24, 0x12, 0xa3, 0xd8, 0x9d, 0xee, 0xf0, 0xd8, 0x66, 0xd2, 0x3e,
+    0x96, 0x46, 0x2b, 0x43, 0x0f, 0x99, 0x3b, 0x03, 0xd2, 0xee, 0xe8, 0x23, 0x11, 0xd1, 0x69, 0xfe,
+    0x88, 0x82, 0xf6, 0x97, 0x5b, 0xb7, 0x06, 0xd6, 0x0d, 0x41, 0xe4, 0x68, 0xce, 0x8e, 0x8e, 0xf6,
+    0x3a, 0xee, 0xab, 0x68, 0xce, 0xd7, 0x43, 0x47, 0x2d, 0x6e, 0xf0, 0x30, 0x67, 0x02, 0xc7, 0x9d,
+    0xd5, 0xe1, 0x67, 0x2b, 0x72, 0x7e, 0xe7, 0x5d, 0x61, 0x38, 0x48, 0x37, 0xb6, 0x7b, 0x10, 0x5a,
+    0xbd, 0x5c, 0x4a, 0x9c, 0x88, 0x64, 0x8d, 0x59, 0x1d, 0xd1, 0xb5, 0x3f, 0x04, 0x5c, 0x84, 0xe3,
+    0x63, 0x76, 0xe4, 0xab, 0x8c, 0xbb, 0x97, 0x20, 0x57, 0xaf, 0x35, 0x2d, 0xec, 0x36, 0x42, 0xaf,
+    0x26, 0x9a, 0xab, 0x7f, 0xb7, 0x09, 0x36, 0x0a, 0xfc, 0x0a, 0x8d, 0xe0, 0x5a, 0xc1, 0x4b, 0xfb,
+    0x61, 0x3b, 0x6c, 0x54, 0xd5, 0xd3, 0x13, 0x7f, 0x79, 0x82, 0x6e, 0x92, 0xa2, 0x79, 0x0d, 0xb2,
+    0x81, 0xcf, 0x8b, 0x0e, 0x73, 0x08, 0xe3, 0xff, 0x72, 0xe0, 0xf4, 0x18, 0x48, 0xbd, 0x8c, 0x76,
+    0x73, 0x7a, 0xa4, 0x4c, 0x3a, 0x22, 0xb6, 0x47, 0xe1, 0x94, 0xde, 0x74, 0xba, 0xb7, 0x0a, 0x7c,
+    0x33, 0xf1, 0xef, 0x38, 0x23, 0xff, 0x8b, 0xe5, 0x2f, 0xeb, 0x9f, 0xe3, 0x66, 0xc9, 0x0c, 0x00,
+    0x00,
+};
+static const StaticPage FILEBROWSER_HTML_PAGE = {FILEBROWSER_HTML_GZ, sizeof(FILEBROWSER_HTML_GZ), "\"3f12d8348a5be36d\""};
+
+// graph_html.h: 11793 bytes, 3343 gzipped
+static const uint8_t GRAPH_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x5a, 0x7b, 0x73, 0xdb, 0x36,
+    0x12, 0xff, 0x5f, 0x9f, 0x02, 0x61, 0xdb, 0x88, 0x8c, 0x25, 0x4a, 0xf2, 0xab, 0xae, 0x64, 0x39,
+    0x6d, 0x1c, 0xbb, 0x4d, 0xc7, 0xa9, 0x33, 0x71, 0x1f, 0x73, 0xe7, 0xfa, 0x5a, 0x88, 0x04, 0x25,
+    0xc4, 0x14, 0xc1, 0x21, 0x21, 0xdb, 0x8a, 0xeb, 0x99, 0xfb, 0x0e, 0xf7, 0x0d, 0xef, 0x93, 0xdc,
+    0xee, 0x02, 0x7c, 0x88, 0x92, 0x13, 0xdf, 0xdc, 0x8d, 0xc6, 0x43, 0x12, 0x8f, 0xdd, 0xc5, 0xee,
+    0x6f, 0x1f, 0x00, 0x7c, 0xf8, 0xec, 0xf5, 0xf9, 0xf1, 0xcf, 0x7f, 0x7b, 0x77, 0xc2, 0x66, 0x7a,
+    0x1e, 0x1f, 0xb5, 0x0e, 0xf1, 0xc1, 0x62, 0x9e, 0x4c, 0xc7, 0x8e, 0x48, 0x1c, 0x6c, 0x10, 0x3c,
+    0x84, 0xc7, 0x5c, 0x68, 0xce, 0x82, 0x19, 0xcf, 0x72, 0xa1, 0xc7, 0xce, 0x2f, 0x3f, 0x9f, 0x76,
+    0x0f, 0x1c, 0xd6, 0x2b, 0x3a, 0x12, 0x3e, 0x17, 0x63, 0xe7, 0x46, 0x8a, 0xdb, 0x54, 0x65, 0xda,
+    0x61, 0x81, 0x4a, 0xb4, 0x48, 0x60, 0xe0, 0xad, 0x0c, 0xf5, 0x6c, 0x1c, 0x8a, 0x1b, 0x19, 0x88,
+    0x2e, 0x7d, 0x74, 0x98, 0x4c, 0xa4, 0x96, 0x3c, 0xee, 0xe6, 0x01, 0x8f, 0xc5, 0x78, 0x60, 0xc8,
+    0x68, 0xa9, 0x63, 0x71, 0x74, 0x21, 0x92, 0x5c, 0x65, 0xec, 0xfb, 0x8c, 0xa7, 0x33, 0xd6, 0x65,
+    0xaf, 0x79, 0x76, 0xcd, 0xde, 0xaa, 0x50, 0x1c, 0xf6, 0x4c, 0x7f, 0xeb, 0x30, 0xd7, 0x4b, 0x7c,
+    0xa2, 0x98, 0x1d, 0x36, 0x51, 0xe1, 0x92, 0xdd, 0xb7, 0xe6, 0x3c, 0x9b, 0xca, 0x64, 0xc8, 0xfa,
+    0x23, 0x96, 0xf2, 0x30, 0x94, 0xc9, 0x94, 0xde, 0x23, 0x10, 0xa2, 0x1b, 0xf1, 0xb9, 0x8c, 0x97,
+    0x43, 0x96, 0xf3, 0x24, 0xef, 0xe6, 0x22, 0x93, 0xd1, 0xa8, 0x35, 0xe1, 0xc1, 0xf5, 0x34, 0x53,
+    0x8b, 0x24, 0xec, 0x06, 0x2a, 0x56, 0xd9, 0x90, 0x7d, 0x31, 0xd8, 0xc6, 0xdf, 0xa8, 0x55, 0x7c,
+    0x8b, 0x3e, 0xfe, 0x46, 0xad, 0x87, 0x56, 0xc0, 0x93, 0x1b, 0x9e, 0x03, 0x17, 0x92, 0x7e, 0xc8,
+    0x06, 0xfd, 0xfe, 0x57, 0xa3, 0xd6, 0x4c, 0xc8, 0xe9, 0x4c, 0x0f, 0xd9, 0x37, 0xfd, 0x9b, 0xd9,
+    0xa8, 0x15, 0xca, 0x3c, 0x8d, 0x39, 0x70, 0x99, 0xc4, 0x2a, 0xb8, 0xde, 0xcc, 0x40, 0xe0, 0x0f,
+    0xba, 0x54, 0x16, 0x0a, 0x68, 0x18, 0xa4, 0x77, 0x2c, 0x57, 0xb1, 0x0c, 0xd9, 0x17, 0x3b, 0x3b,
+    0x3b, 0x45, 0x7b, 0x37, 0xe3, 0xa1, 0x5c, 0xe4, 0x43, 0xb6, 0x9b, 0xde, 0x21, 0xf3, 0x2f, 0x50,
+    0x91, 0x99, 0x8a, 0x91, 0x7f, 0xb9, 0xb4, 0x41, 0x26, 0xe6, 0x9b, 0x79, 0x44, 0xf8, 0x2b, 0x69,
+    0x4d, 0x94, 0xd6, 0x6a, 0xbe, 0xce, 0xea, 0xa1, 0x25, 0x93, 0x74, 0xa1, 0x41, 0x7d, 0x0b, 0x18,
+    0x90, 0x00, 0x69, 0xd2, 0x54, 0x2e, 0x3f, 0x8a, 0x4f, 0x10, 0xa7, 0xa9, 0x4d, 0xf5, 0x6c, 0x58,
+    0xcd, 0xde, 0xde, 0xde, 0xda, 0x6a, 0x76, 0x70, 0x35, 0x95, 0x69, 0xfc, 0x1d, 0x60, 0x02, 0x8f,
+    0x3d, 0xe2, 0x65, 0xc5, 0x19, 0x0e, 0x41, 0x85, 0x81, 0x98, 0xa9, 0x18, 0x66, 0x82, 0x4c, 0x05,
+    0xab, 0x83, 0x83, 0x83, 0x6a, 0x4c, 0xa4, 0x82, 0x45, 0x5e, 0x08, 0x3e, 0x9c, 0xa9, 0x1b, 0x1a,
+    0xaa, 0x16, 0x3a, 0x96, 0x09, 0x08, 0x9f, 0xa8, 0xa4, 0x54, 0x71, 0x29, 0xf8, 0xfe, 0x3e, 0xe7,
+    0x11, 0x69, 0xe5, 0xae, 0x9b, 0xcf, 0x78, 0xa8, 0x6e, 0x41, 0x04, 0xf8, 0xed, 0x81, 0xcc, 0x65,
+    0xe7, 0x43, 0xeb, 0xb0, 0x67, 0xa1, 0x75, 0xd8, 0xb3, 0x90, 0x47, 0x74, 0xc1, 0x23, 0x94, 0x37,
+    0x4c, 0x86, 0x63, 0xa7, 0x30, 0x05, 0x3a, 0x05, 0x49, 0xc3, 0xf4, 0x32, 0x05, 0xd4, 0x6b, 0x71,
+    0x07, 0x88, 0xc7, 0x11, 0x91, 0x8c, 0xc5, 0x1b, 0xec, 0x71, 0x58, 0x6d, 0x2d, 0x63, 0xa7, 0x17,
+    0xab, 0x69, 0xde, 0xdb, 0xee, 0x6f, 0xef, 0xf5, 0xbf, 0x1e, 0xec, 0xfc, 0x31, 0xd8, 0xf5, 0x27,
+    0x32, 0x71, 0x18, 0x2a, 0x7c, 0xec, 0xec, 0xf6, 0x8d, 0x03, 0x58, 0x63, 0xa8, 0x24, 0x88, 0x65,
+    0x70, 0x3d, 0x76, 0x62, 0xc5, 0xc3, 0x53, 0x20, 0xe8, 0x7a, 0xce, 0xd1, 0x19, 0xbc, 0x1f, 0xf6,
+    0xcc, 0x88, 0x06, 0xf7, 0x90, 0x6b, 0xa1, 0xe5, 0x5c, 0x74, 0x01, 0x79, 0x3c, 0xb6, 0x72, 0x64,
+    0x6a, 0x6e, 0xe5, 0xe8, 0x3d, 0x61, 0xb8, 0x56, 0xb5, 0xc1, 0x9b, 0xc4, 0x78, 0x0f, 0xe1, 0xa0,
+    0x94, 0x83, 0x65, 0xf8, 0x55, 0x93, 0xc6, 0xce, 0x40, 0x4a, 0xb1, 0xbc, 0x11, 0xaf, 0xe8, 0xd3,
+    0xa9, 0x28, 0x68, 0x35, 0x9d, 0xc6, 0xe2, 0x0c, 0xba, 0x88, 0x04, 0x3c, 0x6b, 0x93, 0x7b, 0xa0,
+    0x5d, 0x78, 0x58, 0x27, 0x23, 0x35, 0x43, 0x8c, 0xd1, 0xce, 0xd1, 0x61, 0xcf, 0xb4, 0xa1, 0xcb,
+    0x07, 0x99, 0x4c, 0x35, 0xcb, 0xb3, 0x60, 0xec, 0xcc, 0xb4, 0x4e, 0xf3, 0x61, 0xaf, 0x17, 0x84,
+    0x89, 0xff, 0x21, 0x0f, 0x05, 0x70, 0xcc, 0xfc, 0x44, 0xe8, 0x5e, 0x92, 0xce, 0x7b, 0x34, 0x15,
+    0x9a, 0xbf, 0xdd, 0xf5, 0x77, 0xfc, 0x3e, 0x90, 0xce, 0xb5, 0x6d, 0x5b, 0xcc, 0x43, 0x7f, 0x2e,
+    0x71, 0x0a, 0x52, 0x36, 0x04, 0xff, 0x6b, 0xca, 0x1f, 0xf2, 0x2e, 0x0f, 0x79, 0xaa, 0x01, 0x5b,
+    0xa8, 0xc6, 0x6e, 0x94, 0xe4, 0xdf, 0x6e, 0xfb, 0xfd, 0x15, 0x4e, 0x1b, 0xc6, 0xf8, 0x13, 0x70,
+    0xa3, 0x58, 0x3c, 0xce, 0xff, 0xa8, 0x15, 0x0b, 0x4d, 0xb1, 0x55, 0xa3, 0x87, 0x25, 0xb9, 0x66,
+    0xc7, 0xe7, 0x67, 0xe7, 0xef, 0x2f, 0xd8, 0x98, 0x5d, 0xb6, 0x33, 0x11, 0xb6, 0x3b, 0xac, 0x3d,
+    0x89, 0x17, 0x02, 0x9f, 0xd3, 0x4c, 0x88, 0x04, 0x5f, 0x14, 0xd9, 0x01, 0xdf, 0xd2, 0x45, 0x96,
+    0xc6, 0xf4, 0x16, 0x2c, 0x39, 0xf5, 0xcd, 0xf9, 0x14, 0xa2, 0x2f, 0xc7, 0xd7, 0xa5, 0x88, 0x63,
+    0x75, 0xdb, 0xbe, 0x1a, 0x41, 0xfc, 0x4a, 0x00, 0xfb, 0x3e, 0x78, 0xe1, 0xc9, 0x0d, 0xf4, 0x9e,
+    0x81, 0xcc, 0x22, 0x11, 0x99, 0xdb, 0x7e, 0x7d, 0xfe, 0xf6, 0xd8, 0xc4, 0x6b, 0xb4, 0x2f, 0xb1,
+    0x73, 0x3d, 0x36, 0x3e, 0x22, 0x27, 0x44, 0x69, 0x02, 0x7d, 0x07, 0xa2, 0x84, 0xe0, 0x7b, 0x73,
+    0x18, 0xe4, 0x4f, 0x85, 0x3e, 0x89, 0x05, 0xbe, 0xbe, 0x5a, 0xbe, 0x09, 0xdd, 0x36, 0x49, 0xde,
+    0xf6, 0xb0, 0x9d, 0xe8, 0xdc, 0x69, 0xb7, 0xbd, 0x1d, 0xb6, 0x3d, 0x58, 0x0c, 0xf6, 0xc0, 0xd4,
+    0x44, 0xdc, 0xb2, 0x63, 0x7c, 0x77, 0x81, 0x54, 0x07, 0xe8, 0x22, 0x18, 0x87, 0xac, 0x8d, 0x5e,
+    0xdb, 0xee, 0xb4, 0x40, 0x53, 0x7c, 0x08, 0xad, 0x31, 0x9f, 0x88, 0x18, 0xc2, 0xc5, 0xe5, 0x95,
+    0x69, 0x83, 0x54, 0x43, 0x5f, 0xad, 0x87, 0x4e, 0x4b, 0xa5, 0x5a, 0x82, 0x30, 0x38, 0x2c, 0x13,
+    0x79, 0x0a, 0xaf, 0x00, 0xa4, 0x21, 0xd3, 0xd9, 0x42, 0x74, 0x5a, 0x94, 0x49, 0xa8, 0xef, 0x6e,
+    0x58, 0x51, 0x47, 0x9c, 0x03, 0x75, 0x7c, 0x40, 0x2b, 0x5b, 0x40, 0xda, 0x81, 0x56, 0x30, 0xc3,
+    0x42, 0x8b, 0x36, 0x7b, 0xc0, 0x1e, 0xc8, 0x29, 0xd8, 0x55, 0xc6, 0x6f, 0x22, 0xc7, 0x70, 0x09,
+    0x30, 0xf2, 0x67, 0x9a, 0xcf, 0x6c, 0x1c, 0x69, 0xdb, 0xa0, 0x67, 0x67, 0x06, 0xd7, 0xc8, 0xaf,
+    0xea, 0x9c, 0x4c, 0x26, 0xd4, 0x33, 0xcd, 0x64, 0xb8, 0xd2, 0x01, 0x71, 0x13, 0x3a, 0x70, 0x09,
+    0x4b, 0x94, 0x6d, 0x22, 0x20, 0x55, 0x7d, 0xa7, 0xff, 0x2e, 0x32, 0x55, 0x48, 0xff, 0x19, 0x31,
+    0xbe, 0x7b, 0x7d, 0xcc, 0x7e, 0xe5, 0xc6, 0xfc, 0xff, 0x27, 0x59, 0x50, 0x9a, 0x34, 0x5e, 0x80,
+    0x24, 0xa4, 0xb4, 0x58, 0x00, 0x5c, 0x68, 0x64, 0xaa, 0x72, 0x89, 0x7a, 0x46, 0xed, 0xa9, 0x14,
+    0x18, 0x16, 0x26, 0xb9, 0xdf, 0xc0, 0xfa, 0x09, 0x2a, 0xb4, 0xf9, 0xfc, 0x3d, 0x04, 0x54, 0x08,
+    0xfd, 0x39, 0x73, 0xbf, 0x7f, 0xf7, 0xe6, 0x7c, 0xf7, 0xdf, 0xff, 0xfc, 0xd7, 0xbe, 0xb7, 0x71,
+    0x35, 0x2d, 0xfa, 0x01, 0x72, 0xf0, 0x2f, 0x5a, 0x24, 0x01, 0x0a, 0xc3, 0x42, 0x11, 0x40, 0x0d,
+    0x70, 0xc1, 0xe7, 0x00, 0xf3, 0x33, 0x35, 0x75, 0x27, 0x8b, 0xc8, 0x2b, 0xc1, 0x89, 0x45, 0x87,
+    0x85, 0xd8, 0x6b, 0xc0, 0xcc, 0xaf, 0xf0, 0x49, 0x03, 0x0a, 0x57, 0x02, 0x5f, 0x90, 0x01, 0x0c,
+    0xb8, 0xd0, 0x19, 0x88, 0xe0, 0x63, 0x6c, 0x44, 0x28, 0x1e, 0x03, 0x45, 0xd7, 0xf7, 0x7d, 0x9c,
+    0xf7, 0x8b, 0x4c, 0xf4, 0xc1, 0x77, 0x59, 0xc6, 0x97, 0x38, 0xb3, 0xc3, 0xfa, 0x1d, 0xf6, 0x96,
+    0xeb, 0x19, 0x7a, 0xac, 0xbb, 0x8b, 0xd9, 0x26, 0xf2, 0x27, 0x4b, 0x2d, 0xce, 0x44, 0x32, 0xd5,
+    0x33, 0xcf, 0x2b, 0x49, 0x43, 0x36, 0x88, 0x17, 0x29, 0xd0, 0xb6, 0x3c, 0xc6, 0x63, 0xe6, 0x5c,
+    0xbc, 0x7d, 0xff, 0x8b, 0x53, 0x0c, 0x80, 0xf4, 0x94, 0xe3, 0x02, 0xc6, 0x0d, 0x1a, 0xec, 0x90,
+    0x0d, 0xf6, 0xd9, 0x4b, 0x48, 0x42, 0x43, 0x92, 0x1f, 0x5d, 0x87, 0x84, 0x70, 0x77, 0x81, 0xb8,
+    0x8c, 0x98, 0xeb, 0x1a, 0x92, 0xcf, 0x0c, 0xc9, 0xb3, 0xef, 0x1d, 0xf6, 0xfc, 0x39, 0x7b, 0x66,
+    0x18, 0x7a, 0xec, 0xaf, 0xbf, 0xd8, 0x33, 0xb7, 0x24, 0x0e, 0x63, 0x06, 0xd8, 0xb4, 0xd2, 0xb2,
+    0x5d, 0x9f, 0xe0, 0xa1, 0xba, 0xf4, 0x2c, 0x53, 0xb7, 0xa4, 0xa7, 0x93, 0x2c, 0x53, 0x99, 0xeb,
+    0x24, 0x4a, 0x33, 0xce, 0x72, 0x63, 0x22, 0x48, 0x51, 0x8e, 0x47, 0xf5, 0x8e, 0x71, 0x79, 0xc8,
+    0xfd, 0xe8, 0xb9, 0xab, 0xd2, 0xed, 0x55, 0x4b, 0x07, 0x93, 0x64, 0xe1, 0x05, 0x64, 0xb0, 0xc6,
+    0xa0, 0xc1, 0xbe, 0xbb, 0xdf, 0x21, 0x10, 0x94, 0x63, 0xb1, 0x38, 0xcc, 0x31, 0x96, 0x41, 0x10,
+    0xc2, 0x48, 0x17, 0x02, 0x1a, 0x26, 0x3c, 0x81, 0x48, 0x03, 0x8d, 0x86, 0xd1, 0x11, 0xea, 0x1c,
+    0xd2, 0x6e, 0xa6, 0x27, 0x82, 0x23, 0xdf, 0x37, 0x49, 0x84, 0x65, 0xe2, 0x12, 0x50, 0x00, 0xc2,
+    0xb9, 0x38, 0x4d, 0x42, 0x33, 0x54, 0x75, 0x12, 0x94, 0x47, 0x93, 0xe0, 0x75, 0x6b, 0xab, 0xc2,
+    0x41, 0xc6, 0x0b, 0x18, 0x34, 0xcd, 0x09, 0xaa, 0xde, 0x62, 0x83, 0x6d, 0xf6, 0x82, 0xc9, 0x0e,
+    0x3b, 0x00, 0xb1, 0x48, 0x20, 0x3f, 0x5d, 0xe4, 0x33, 0xf7, 0x11, 0x54, 0x00, 0x31, 0xcf, 0xcf,
+    0x04, 0x65, 0x71, 0xb7, 0xf7, 0x7b, 0x7f, 0xeb, 0xcb, 0x5e, 0x87, 0x39, 0x0e, 0x9a, 0x7e, 0x45,
+    0xfa, 0xda, 0x07, 0xa8, 0x7b, 0x55, 0x59, 0x35, 0xb6, 0xf0, 0xf2, 0x8d, 0x87, 0x8b, 0xc4, 0xc2,
+    0xb1, 0x5a, 0x64, 0x09, 0xb2, 0xb2, 0xb1, 0xd3, 0xd4, 0xe5, 0x2a, 0x91, 0x41, 0xdf, 0xaa, 0x96,
+    0x2c, 0x85, 0x38, 0x59, 0x31, 0x79, 0xa5, 0x8c, 0x5c, 0xe4, 0xd8, 0x9c, 0x5b, 0x8d, 0x5c, 0x08,
+    0xed, 0xd6, 0x50, 0x7b, 0x9b, 0x93, 0xe8, 0x95, 0x53, 0xbd, 0xc2, 0xb2, 0x35, 0x77, 0x91, 0x77,
+    0x5d, 0x5d, 0xa4, 0xe6, 0x8e, 0xb1, 0x5f, 0xa7, 0xa4, 0x09, 0x84, 0x32, 0xa1, 0x17, 0x59, 0xd2,
+    0x58, 0xbd, 0x05, 0x1b, 0xc0, 0x1a, 0xea, 0xa0, 0xf8, 0x07, 0x11, 0x87, 0x2e, 0xb2, 0x2a, 0xe7,
+    0xd7, 0x57, 0xb6, 0xb3, 0xed, 0x1e, 0xd8, 0xa5, 0xd4, 0xec, 0x5e, 0xe3, 0x01, 0x8e, 0x81, 0x93,
+    0x2b, 0x40, 0x5a, 0xa9, 0x11, 0x43, 0x25, 0x22, 0x54, 0x14, 0x41, 0x53, 0x43, 0xde, 0x11, 0x35,
+    0x6f, 0xd5, 0x11, 0x7a, 0xd8, 0xf4, 0x3f, 0x3b, 0x66, 0x5c, 0x1b, 0x54, 0x03, 0x92, 0x42, 0x20,
+    0xdd, 0x33, 0xcc, 0x1b, 0xb9, 0x06, 0xfd, 0x0c, 0x9b, 0xa2, 0xc3, 0x64, 0x2b, 0x3c, 0x7b, 0x78,
+    0x0a, 0x40, 0x81, 0xe2, 0x25, 0x29, 0xe1, 0x52, 0x5e, 0x5d, 0xc1, 0xa0, 0x52, 0x51, 0x0d, 0x63,
+    0x1b, 0xc1, 0xf7, 0xe9, 0xcf, 0x18, 0x7c, 0xb7, 0xe0, 0x33, 0xdc, 0x3c, 0x76, 0x17, 0xfe, 0x2c,
+    0xb0, 0xad, 0xcb, 0x3d, 0x20, 0x37, 0x0b, 0x6e, 0x78, 0x33, 0x2d, 0xc6, 0x5c, 0x85, 0x42, 0xcb,
+    0xb8, 0x5a, 0xd9, 0x89, 0xd4, 0x50, 0x99, 0x2a, 0x85, 0x7d, 0x92, 0x0a, 0xdf, 0xe6, 0x8f, 0xd8,
+    0xa6, 0xd0, 0x14, 0xd6, 0xb7, 0xb0, 0x9c, 0x0a, 0xd2, 0x5b, 0x06, 0xd2, 0x81, 0x90, 0xb1, 0x5b,
+    0xd0, 0x60, 0x3d, 0xdc, 0x32, 0xf5, 0x9b, 0xf0, 0x2b, 0x0d, 0x59, 0x29, 0x5d, 0x45, 0xd6, 0x1e,
+    0x35, 0x16, 0x31, 0xcf, 0x35, 0x69, 0xec, 0x36, 0xbf, 0xa4, 0x85, 0xc5, 0x26, 0x80, 0x76, 0xd9,
+    0xe0, 0xaa, 0xa0, 0x38, 0xe5, 0x18, 0x83, 0x69, 0xe4, 0x4b, 0x1c, 0xe9, 0x97, 0x96, 0x83, 0x61,
+    0xd8, 0x5c, 0x6b, 0xc0, 0x8d, 0x21, 0x39, 0x0e, 0x4e, 0x3a, 0x32, 0x2b, 0xc0, 0xd0, 0x49, 0xb3,
+    0x01, 0xc4, 0xc5, 0x22, 0xfd, 0x19, 0xcf, 0x49, 0x7f, 0x5e, 0x25, 0x8b, 0x98, 0xa7, 0x7a, 0xd9,
+    0x84, 0x46, 0x83, 0x3e, 0x20, 0xb1, 0xc4, 0x44, 0x15, 0xfd, 0x70, 0x69, 0xa4, 0x5a, 0xcf, 0x10,
+    0x21, 0x34, 0x20, 0x12, 0x92, 0x45, 0x1c, 0x8f, 0x6a, 0x16, 0xa3, 0x5e, 0xb4, 0x19, 0x83, 0xac,
+    0x2b, 0x58, 0x25, 0x68, 0xdf, 0xa3, 0x6d, 0x9a, 0x45, 0xda, 0x35, 0xc2, 0xbe, 0x03, 0xb4, 0xa4,
+    0xd6, 0x14, 0x87, 0x56, 0xa5, 0x18, 0x31, 0xf7, 0x1a, 0x25, 0xf1, 0x00, 0x19, 0xa5, 0x19, 0xc0,
+    0x09, 0x90, 0xd4, 0x0b, 0xb2, 0x06, 0xf4, 0xee, 0xf5, 0x01, 0xab, 0xd7, 0xf5, 0x08, 0xaa, 0xd7,
+    0x08, 0x15, 0x06, 0x8d, 0x62, 0x05, 0x09, 0xe3, 0xba, 0x4e, 0xae, 0xb4, 0x2a, 0xca, 0xa8, 0x29,
+    0x51, 0x15, 0xe2, 0x80, 0x1a, 0x4d, 0xc3, 0x8a, 0x2d, 0x3c, 0x56, 0x2d, 0xf3, 0x9e, 0x41, 0x8c,
+    0x45, 0x56, 0x9d, 0xba, 0x2a, 0x35, 0xc3, 0xac, 0x5f, 0x2d, 0x4a, 0x8f, 0xa8, 0x1c, 0x78, 0x3a,
+    0x9e, 0x1f, 0x0d, 0x69, 0xe4, 0xb0, 0xcd, 0x30, 0x56, 0x95, 0xb7, 0x36, 0xd7, 0x99, 0xb4, 0x60,
+    0x00, 0xb6, 0x01, 0xad, 0xa6, 0x61, 0x91, 0x7c, 0x94, 0xd3, 0x8f, 0x7c, 0x0a, 0x8d, 0xee, 0x47,
+    0xaa, 0x92, 0xdd, 0x8f, 0xec, 0xe8, 0xe8, 0x08, 0xb5, 0xfd, 0x0f, 0xd6, 0x85, 0x8f, 0xe7, 0xf0,
+    0x0a, 0xd5, 0xf6, 0x0c, 0xf6, 0x6e, 0xcc, 0xba, 0xe9, 0x37, 0xf0, 0xb7, 0x53, 0x04, 0x28, 0xb4,
+    0x04, 0x39, 0x73, 0xad, 0xa6, 0xa8, 0x02, 0x37, 0x09, 0x9f, 0xaf, 0x27, 0xd5, 0x5a, 0xcc, 0x79,
+    0xce, 0xfa, 0x77, 0x5f, 0x9f, 0x9e, 0x9e, 0x8e, 0x56, 0x83, 0x3d, 0x4a, 0xf4, 0xe9, 0x49, 0x07,
+    0x68, 0x31, 0xb2, 0x4c, 0xbf, 0x98, 0x9b, 0xf2, 0x25, 0xee, 0xf0, 0x36, 0xf2, 0xc3, 0xd8, 0xd2,
+    0x48, 0xe5, 0x74, 0x06, 0x52, 0xcf, 0xe5, 0x13, 0xa9, 0xf3, 0x77, 0x22, 0x33, 0x3a, 0xa7, 0xf8,
+    0x57, 0xa1, 0x34, 0x32, 0xf1, 0x30, 0xc2, 0x05, 0xdb, 0x80, 0x18, 0x19, 0xbc, 0x19, 0x32, 0xc6,
+    0xa8, 0xab, 0x49, 0xd3, 0xb0, 0x3d, 0xb0, 0x61, 0xcd, 0xe8, 0x6b, 0x8b, 0x45, 0x98, 0xf0, 0x56,
+    0x59, 0x41, 0xf0, 0x36, 0x54, 0x2e, 0xa3, 0xab, 0x2a, 0x4b, 0x00, 0x92, 0x68, 0xc3, 0xb1, 0x41,
+    0xed, 0x06, 0xa9, 0xa5, 0x7e, 0x51, 0x09, 0xe8, 0xf9, 0x85, 0x02, 0x50, 0x2b, 0x55, 0xf0, 0x2a,
+    0xc7, 0x75, 0x8d, 0x17, 0xad, 0xf2, 0xee, 0x41, 0x15, 0x81, 0x73, 0x0d, 0xb7, 0xad, 0x92, 0xc6,
+    0xd1, 0x26, 0xbb, 0x4e, 0x32, 0xc1, 0xaf, 0x47, 0x8c, 0xf5, 0x7a, 0x4c, 0x2b, 0x40, 0xad, 0xe6,
+    0x32, 0x06, 0x79, 0x51, 0x41, 0xba, 0x69, 0x67, 0x93, 0x5b, 0x6a, 0x71, 0xbf, 0x03, 0x98, 0x8e,
+    0x35, 0x67, 0x35, 0x8b, 0xdd, 0xe0, 0x56, 0x60, 0x2d, 0x15, 0x3e, 0x92, 0x7b, 0xcc, 0xe0, 0x75,
+    0x45, 0x97, 0x06, 0x3e, 0x68, 0x24, 0x90, 0xd2, 0xd2, 0xe8, 0x86, 0x88, 0xa8, 0x95, 0x8d, 0xe0,
+    0x86, 0xd4, 0x08, 0x6b, 0x78, 0x42, 0x0e, 0x6c, 0x66, 0x40, 0x23, 0x17, 0x7c, 0x8c, 0xd6, 0xdd,
+    0xdb, 0x84, 0x00, 0xd7, 0x86, 0x16, 0x0b, 0x6e, 0xaf, 0x8a, 0xcc, 0xb0, 0x81, 0x75, 0x37, 0xe6,
+    0x03, 0xcf, 0x40, 0x12, 0x93, 0x01, 0x59, 0xa6, 0x43, 0x66, 0x43, 0x81, 0x3a, 0x8c, 0xdf, 0x80,
+    0xda, 0xf9, 0x64, 0x0d, 0xa3, 0xd8, 0x3d, 0x18, 0xc1, 0xe3, 0xb0, 0x70, 0x3d, 0xf8, 0x30, 0x20,
+    0x7d, 0x0a, 0x8e, 0x8d, 0x93, 0x57, 0xc4, 0x0f, 0x2b, 0x50, 0x92, 0xed, 0x91, 0xff, 0x56, 0xb3,
+    0x8a, 0x4e, 0x71, 0xf2, 0x0b, 0x54, 0xfb, 0x8b, 0x4a, 0xae, 0x51, 0xab, 0xa2, 0x02, 0x33, 0x0e,
+    0x2a, 0x4c, 0x7f, 0xc4, 0xed, 0x03, 0x12, 0xfa, 0xca, 0x4c, 0xa9, 0xc1, 0xde, 0xae, 0xaf, 0x16,
+    0xa3, 0xa9, 0xa5, 0xd7, 0x18, 0xe8, 0xd5, 0x89, 0x77, 0x57, 0x1c, 0x07, 0x55, 0x1c, 0x19, 0x6f,
+    0x40, 0x81, 0x0d, 0xda, 0x80, 0x7f, 0x11, 0xe6, 0x20, 0xc6, 0x8d, 0x5a, 0x66, 0x11, 0xd4, 0x57,
+    0xa6, 0xa6, 0xfb, 0x96, 0xb5, 0x61, 0x44, 0xba, 0xa7, 0xe0, 0xb3, 0xd2, 0xb0, 0x55, 0xa7, 0x61,
+    0xe2, 0xcf, 0x29, 0x05, 0x2d, 0x8c, 0xe9, 0x85, 0x85, 0x1f, 0x5a, 0xa6, 0x86, 0x6b, 0x78, 0xd2,
+    0xe7, 0x83, 0xfc, 0x8f, 0xb9, 0x4a, 0xce, 0x64, 0x22, 0x72, 0x17, 0x77, 0x9a, 0x2b, 0xc5, 0xdb,
+    0x9a, 0x6f, 0xe0, 0x29, 0x03, 0x66, 0x60, 0x1c, 0xe9, 0x43, 0xbd, 0x3f, 0x77, 0x3d, 0x1f, 0x36,
+    0xab, 0x20, 0x81, 0xf3, 0x7b, 0xe2, 0x98, 0xbd, 0x51, 0xb6, 0x34, 0x75, 0x9a, 0x85, 0xe2, 0x8f,
+    0x17, 0xe7, 0x3f, 0xf9, 0x29, 0x1e, 0x76, 0xbb, 0x38, 0x9b, 0xea, 0x6d, 0x16, 0x70, 0x1d, 0xcc,
+    0x98, 0x5b, 0x96, 0x8a, 0x2a, 0x16, 0xfe, 0x2d, 0xcf, 0x12, 0xd7, 0xb9, 0xb8, 0x96, 0x69, 0x0a,
+    0xfb, 0x08, 0x26, 0x13, 0x50, 0x82, 0x0c, 0x19, 0xce, 0x27, 0xbe, 0x43, 0xa7, 0x43, 0x4f, 0xcf,
+    0xe6, 0xb2, 0x47, 0x16, 0x55, 0x1d, 0xf6, 0x01, 0x6d, 0xb4, 0xc9, 0x33, 0x3a, 0x3a, 0xc1, 0x2f,
+    0x1e, 0x8b, 0x4c, 0xbb, 0x6d, 0x3a, 0x3e, 0x61, 0xb8, 0x65, 0xb3, 0xc7, 0xe7, 0x50, 0xb3, 0x86,
+    0x6c, 0x29, 0xb4, 0xdf, 0x2e, 0x0b, 0xf2, 0x0a, 0x33, 0x29, 0x20, 0xe2, 0x53, 0x47, 0x36, 0xe5,
+    0x49, 0x65, 0xdb, 0xf3, 0xc9, 0x6c, 0x56, 0x2f, 0x06, 0x10, 0xcf, 0x70, 0x7a, 0xc5, 0xdb, 0x39,
+    0x49, 0xb4, 0xc8, 0x60, 0xab, 0x68, 0xd6, 0x86, 0x73, 0x89, 0x81, 0xef, 0x6c, 0xe0, 0x3c, 0x91,
+    0x09, 0xcf, 0xb0, 0x4a, 0xa2, 0x11, 0x22, 0x09, 0xf3, 0xdf, 0xa4, 0x9e, 0xb9, 0x0e, 0x1d, 0x79,
+    0xe2, 0xa6, 0x5e, 0x80, 0x12, 0x5d, 0xa7, 0xc7, 0x53, 0xd9, 0x43, 0x4a, 0x0e, 0x59, 0x1d, 0xd8,
+    0xb5, 0x7c, 0x3d, 0x13, 0x09, 0x94, 0xa2, 0xb9, 0x89, 0x38, 0x24, 0x08, 0x7c, 0xf9, 0xea, 0xda,
+    0x63, 0x6b, 0x7b, 0xd7, 0x53, 0x80, 0x33, 0xac, 0x5f, 0x2b, 0x52, 0x1d, 0xc9, 0x54, 0x49, 0x53,
+    0x08, 0x01, 0xd5, 0x20, 0xcc, 0xe7, 0xb8, 0x13, 0x7c, 0xb5, 0x88, 0x22, 0x91, 0xb9, 0xb4, 0xaf,
+    0x80, 0x36, 0x3a, 0xa4, 0xa2, 0x63, 0x06, 0xcb, 0x96, 0x6e, 0x12, 0x80, 0x6f, 0x1a, 0x2b, 0xfd,
+    0x1e, 0xac, 0xe3, 0x96, 0x24, 0xd6, 0x0e, 0x1f, 0x60, 0x24, 0x92, 0x69, 0xe2, 0x90, 0xda, 0x3d,
+    0xa0, 0x47, 0x30, 0x71, 0x45, 0x96, 0x99, 0x75, 0x14, 0x3a, 0x44, 0xb9, 0x49, 0x58, 0xc4, 0x09,
+    0xca, 0x3b, 0x64, 0xb8, 0x76, 0x18, 0xe7, 0x43, 0x5c, 0xcc, 0xf9, 0x54, 0xd8, 0x63, 0x8f, 0x06,
+    0x2c, 0xec, 0xe1, 0x6b, 0x89, 0x70, 0xdc, 0xaa, 0x82, 0x7a, 0x5f, 0x73, 0x2d, 0x2c, 0x42, 0x1f,
+    0xb7, 0x72, 0x71, 0x0e, 0x5c, 0x58, 0xd9, 0xb3, 0x65, 0x5b, 0x11, 0xe4, 0x41, 0x7d, 0x4f, 0xa3,
+    0x64, 0x8f, 0x88, 0xd7, 0xe9, 0x90, 0x95, 0x5c, 0x92, 0xe9, 0x10, 0xc8, 0x79, 0x1b, 0x50, 0x63,
+    0x7c, 0x7b, 0x22, 0xc0, 0x1f, 0x05, 0x18, 0x52, 0x30, 0x00, 0xc5, 0x46, 0xe8, 0xcc, 0xf9, 0xdd,
+    0x3b, 0x05, 0x11, 0x32, 0xaf, 0x6f, 0x8d, 0xb7, 0x81, 0x4d, 0xe7, 0xf3, 0x67, 0x8f, 0x41, 0x2c,
+    0xa1, 0xed, 0x37, 0x0c, 0x6c, 0x98, 0x99, 0xf7, 0xa8, 0x34, 0x35, 0x58, 0xfb, 0x93, 0xb0, 0x86,
+    0x57, 0x3f, 0x22, 0x7f, 0x89, 0x92, 0x8e, 0xbf, 0xbc, 0xaf, 0x45, 0x4c, 0x6c, 0xf1, 0x1e, 0x9e,
+    0x6b, 0x55, 0x34, 0x53, 0x01, 0x00, 0x4b, 0x79, 0x78, 0x5e, 0x0a, 0x04, 0x5d, 0xe5, 0xfb, 0xc3,
+    0x9f, 0xff, 0x1b, 0x54, 0xe9, 0xd8, 0xb6, 0x86, 0x55, 0x9c, 0xf7, 0x01, 0x50, 0xb4, 0x02, 0x47,
+    0x23, 0x6d, 0x23, 0xf5, 0xd6, 0xeb, 0x2e, 0xbb, 0x2f, 0x32, 0xfb, 0x87, 0xda, 0x6e, 0x23, 0x45,
+    0x19, 0x31, 0xd8, 0x19, 0x0a, 0x3e, 0x7d, 0xe7, 0x45, 0x54, 0xa1, 0x59, 0x58, 0xe9, 0xe0, 0x3c,
+    0xac, 0xd3, 0xa9, 0xfb, 0xb2, 0x7f, 0x65, 0x37, 0x4a, 0x50, 0xc1, 0xd8, 0x79, 0xb9, 0x16, 0x58,
+    0xfd, 0xdb, 0x2f, 0xdc, 0x26, 0x5d, 0x3c, 0x61, 0x23, 0x54, 0xcd, 0xa0, 0xf9, 0x9b, 0x37, 0x42,
+    0x76, 0x04, 0x58, 0x2e, 0x49, 0x20, 0x95, 0x3c, 0x79, 0x4b, 0xf4, 0x78, 0x0d, 0x52, 0xae, 0x02,
+    0x18, 0x36, 0xa8, 0xfb, 0x20, 0xc0, 0x09, 0x07, 0x14, 0xb8, 0x48, 0xbf, 0xc3, 0x24, 0xd5, 0x33,
+    0x45, 0x39, 0x82, 0xfc, 0xcc, 0xe4, 0x5d, 0x5b, 0x2a, 0x4a, 0x4c, 0x96, 0xcd, 0x92, 0xc4, 0x2a,
+    0xbb, 0x60, 0x83, 0xb2, 0x94, 0x71, 0x02, 0xc7, 0x5a, 0xcb, 0x3d, 0xc5, 0xf1, 0xc9, 0xfa, 0x8f,
+    0x7b, 0xbe, 0x59, 0xe2, 0xd9, 0x9b, 0x5f, 0x4f, 0xfe, 0x78, 0x7f, 0xfe, 0x1b, 0x5e, 0x00, 0x6c,
+    0x7f, 0x8d, 0xfb, 0x34, 0xac, 0x1e, 0x79, 0x02, 0xdb, 0xd5, 0x05, 0x78, 0x94, 0x26, 0x2f, 0x0a,
+    0x45, 0xc4, 0x17, 0xb1, 0xb6, 0x3b, 0x32, 0x03, 0x0a, 0x79, 0x23, 0x2a, 0x50, 0x14, 0x41, 0xa4,
+    0x7e, 0xff, 0x52, 0x9a, 0xd0, 0x5e, 0xda, 0x7c, 0x22, 0x45, 0x54, 0x77, 0x39, 0x6d, 0x9b, 0x16,
+    0xb0, 0x05, 0x29, 0xe0, 0x13, 0x1c, 0x4e, 0x41, 0xc0, 0x40, 0xe5, 0xd4, 0x99, 0x1a, 0xb2, 0x14,
+    0x5e, 0xed, 0x95, 0x02, 0x74, 0xb5, 0x91, 0x77, 0xbb, 0xee, 0xef, 0x28, 0x6c, 0xfd, 0x54, 0x70,
+    0x1d, 0xe2, 0x96, 0x28, 0x7a, 0x11, 0x5e, 0x56, 0x5c, 0xc0, 0xc2, 0x03, 0xe1, 0xb6, 0xc9, 0x95,
+    0xb1, 0xb3, 0x6d, 0x39, 0x6f, 0xb8, 0xce, 0x28, 0x4c, 0xdf, 0x86, 0x0d, 0x32, 0x59, 0xa2, 0x64,
+    0x25, 0x7c, 0xbc, 0x55, 0xb0, 0xb9, 0xbf, 0xdd, 0x01, 0x1a, 0xb4, 0xe3, 0x24, 0x3a, 0x2a, 0xb1,
+    0xb6, 0xc0, 0x71, 0x75, 0xc7, 0x2b, 0xeb, 0xed, 0xb5, 0xd9, 0xfe, 0x9c, 0xa7, 0xee, 0x4f, 0x8b,
+    0xf9, 0x44, 0x64, 0xf5, 0xd3, 0x8d, 0xb5, 0xc3, 0x23, 0x53, 0x16, 0x19, 0x78, 0x9a, 0x3d, 0xe6,
+    0x67, 0x41, 0x59, 0xd4, 0xc7, 0xb8, 0x8b, 0xdf, 0x84, 0x48, 0x34, 0x47, 0xbd, 0xfc, 0x3d, 0xaa,
+    0x30, 0x63, 0xf7, 0xd9, 0xf9, 0x4c, 0x46, 0x94, 0xe2, 0xd6, 0x90, 0xfa, 0x98, 0x95, 0x2e, 0xb4,
+    0x4a, 0x09, 0x42, 0xed, 0x95, 0x1c, 0xb4, 0x3a, 0xbf, 0x76, 0x30, 0x83, 0x17, 0x03, 0x64, 0xae,
+    0x0e, 0x2b, 0xc2, 0x15, 0xbb, 0xaf, 0xef, 0x05, 0xd4, 0xe4, 0x03, 0x9d, 0xe9, 0xd8, 0x79, 0x14,
+    0x25, 0xa1, 0xad, 0x7e, 0x24, 0x80, 0x77, 0xaa, 0x32, 0x59, 0x88, 0x8d, 0x81, 0xe2, 0x7c, 0xf2,
+    0x41, 0x04, 0xda, 0xbf, 0x16, 0xcb, 0xdc, 0x85, 0x79, 0x90, 0x5b, 0x91, 0x04, 0xf5, 0x62, 0x0c,
+    0x6b, 0x97, 0x74, 0xda, 0x74, 0xfc, 0x68, 0x7a, 0x64, 0x62, 0xa5, 0xf1, 0x3c, 0xfb, 0x52, 0x45,
+    0x16, 0x40, 0x93, 0x39, 0x16, 0x36, 0xc2, 0x5b, 0xe5, 0x79, 0x3e, 0x9e, 0x83, 0xb9, 0x08, 0x60,
+    0xf2, 0x75, 0xea, 0x22, 0x5d, 0xdb, 0x3b, 0x05, 0xe1, 0xae, 0x48, 0x6d, 0x8f, 0x50, 0xb0, 0x26,
+    0x6c, 0x0a, 0x5d, 0x31, 0x5f, 0xe1, 0x6d, 0xa8, 0x01, 0x11, 0x2b, 0xca, 0xcb, 0x97, 0xcc, 0x72,
+    0x7b, 0x30, 0x57, 0x64, 0x06, 0x59, 0xa5, 0x4a, 0xcd, 0xcb, 0xa8, 0xde, 0x57, 0x5c, 0x87, 0x41,
+    0x6f, 0x5d, 0x2d, 0x96, 0x1b, 0x21, 0x71, 0x05, 0x4c, 0x6e, 0xeb, 0xde, 0x90, 0x19, 0x32, 0xd3,
+    0x6c, 0x2e, 0xc5, 0x8f, 0xcd, 0x8d, 0x8b, 0xb9, 0x5e, 0x04, 0x78, 0x7d, 0x65, 0x5f, 0xad, 0x2a,
+    0xc0, 0x94, 0xe6, 0x2e, 0xae, 0x2e, 0x7d, 0x87, 0xce, 0x09, 0x87, 0x2c, 0xe2, 0x58, 0xf7, 0x3f,
+    0x78, 0xc5, 0xbd, 0x9e, 0xbf, 0x48, 0xf1, 0x8a, 0xd3, 0x94, 0xf1, 0xb5, 0x4b, 0xcd, 0x9e, 0xbd,
+    0x37, 0xef, 0x99, 0xff, 0x28, 0xf9, 0x0f, 0xef, 0xc5, 0xdb, 0x55, 0x62, 0x22, 0x00, 0x00,
+};
+static const StaticPage GRAPH_HTML_PAGE = {GRAPH_HTML_GZ, sizeof(GRAPH_HTML_GZ), "\"3fda75c6fcdf5e34\""};
+
+// index_html.h: 9056 bytes, 2067 gzipped
+static const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x59, 0xdb, 0x8e, 0xe3, 0xc6,
+    0x11, 0x7d, 0xd7, 0x57, 0xf4, 0xf6, 0x26, 0xb0, 0x84, 0x0c, 0xa9, 0x8b, 0x77, 0xb3, 0x86, 0x6e,
+    0x86, 0x3d, 0x17, 0xef, 0x04, 0xb3, 0x9e, 0x81, 0x47, 0x86, 0x91, 0x37, 0xb7, 0xc8, 0xa6, 0xd8,
+    0x59, 0x8a, 0x4d, 0x37, 0x5b, 0xa3, 0x51, 0xc6, 0xf3, 0xee, 0x37, 0x03, 0xce, 0x53, 0x02, 0x04,
+    0xc9, 0x5b, 0x7e, 0xc1, 0xdf, 0xe3, 0x1f, 0x70, 0x3e, 0x21, 0x55, 0xdd, 0x4d, 0x51, 0x17, 0x52,
+    0xa3, 0x8d, 0x37, 0x81, 0x21, 0x60, 0x24, 0x92, 0x5d, 0xa7, 0xaa, 0x4e, 0xdd, 0xba, 0x39, 0xc3,
+    0x67, 0x67, 0xd7, 0xa7, 0x93, 0x3f, 0xde, 0x9c, 0x93, 0x58, 0xcf, 0x93, 0x71, 0x63, 0x88, 0x5f,
+    0x24, 0x61, 0xe9, 0x6c, 0x44, 0x79, 0x4a, 0xf1, 0x06, 0x67, 0x21, 0x7c, 0xcd, 0xb9, 0x66, 0x24,
+    0x88, 0x99, 0xca, 0xb9, 0x1e, 0xd1, 0x2f, 0x27, 0x17, 0xde, 0x47, 0x94, 0xb4, 0x8b, 0x07, 0x29,
+    0x9b, 0xf3, 0x11, 0xbd, 0x13, 0x7c, 0x99, 0x49, 0xa5, 0x29, 0x09, 0x64, 0xaa, 0x79, 0x0a, 0x0b,
+    0x97, 0x22, 0xd4, 0xf1, 0x28, 0xe4, 0x77, 0x22, 0xe0, 0x9e, 0xb9, 0x38, 0x21, 0x22, 0x15, 0x5a,
+    0xb0, 0xc4, 0xcb, 0x03, 0x96, 0xf0, 0x51, 0xd7, 0xef, 0x58, 0x20, 0x2d, 0x74, 0xc2, 0xc7, 0x9f,
+    0x5f, 0x5f, 0x9e, 0x9e, 0x9f, 0x90, 0x37, 0xd7, 0x97, 0xb7, 0x13, 0xf2, 0x6c, 0xd8, 0xb6, 0x77,
+    0x1b, 0xc3, 0x5c, 0xaf, 0xf0, 0x7b, 0x2a, 0xc3, 0x15, 0x79, 0x68, 0xcc, 0x99, 0x9a, 0x89, 0xb4,
+    0x4f, 0x3a, 0x83, 0x46, 0x04, 0xaa, 0xbc, 0x88, 0xcd, 0x45, 0xb2, 0xea, 0x93, 0x9c, 0xa5, 0xb9,
+    0x97, 0x73, 0x25, 0xa2, 0x41, 0x63, 0xca, 0x82, 0xb7, 0x33, 0x25, 0x17, 0x69, 0xe8, 0x05, 0x32,
+    0x91, 0xaa, 0x4f, 0x9e, 0x77, 0x19, 0x7e, 0x06, 0x8d, 0xe2, 0x3a, 0x08, 0x82, 0x41, 0x23, 0x14,
+    0x79, 0x96, 0x30, 0x10, 0x8e, 0x12, 0x7e, 0x3f, 0x68, 0xc4, 0x5c, 0xcc, 0x62, 0xdd, 0x27, 0xdd,
+    0x4e, 0xe7, 0x2e, 0x1e, 0x34, 0xe4, 0x1d, 0x57, 0x51, 0x22, 0x97, 0x7d, 0x12, 0x8b, 0x30, 0xe4,
+    0xe9, 0xa0, 0xf1, 0xd8, 0xf0, 0x73, 0x11, 0xf2, 0x29, 0x53, 0x60, 0x88, 0x71, 0xa9, 0x4f, 0x7e,
+    0xdf, 0xc9, 0xee, 0xab, 0x35, 0x76, 0xbb, 0x7b, 0x1a, 0xf0, 0xaf, 0x17, 0x0a, 0xc5, 0x03, 0x2d,
+    0x24, 0x38, 0x01, 0x6b, 0x17, 0x73, 0x00, 0x66, 0x89, 0x98, 0xa5, 0x9e, 0xd0, 0x7c, 0x9e, 0xc3,
+    0x4d, 0xa0, 0x8f, 0xab, 0x41, 0x23, 0x63, 0x61, 0x28, 0xd2, 0x19, 0xd8, 0xa3, 0xf8, 0x1c, 0xfd,
+    0xdd, 0x50, 0x3f, 0x5d, 0x68, 0x2d, 0x53, 0xb0, 0xa2, 0x54, 0xdc, 0x27, 0xa9, 0x4c, 0x39, 0x98,
+    0x22, 0x55, 0xc8, 0x55, 0x71, 0x55, 0x58, 0xf3, 0xea, 0xd5, 0x2b, 0x47, 0x58, 0x2e, 0xfe, 0xcc,
+    0x01, 0xd3, 0x7f, 0x09, 0xa8, 0x83, 0x35, 0x9d, 0x85, 0x8e, 0x60, 0xa1, 0x72, 0x14, 0xc8, 0xa4,
+    0xb0, 0x56, 0x68, 0x05, 0xc4, 0x8a, 0xb5, 0xb9, 0x52, 0x91, 0x8e, 0xdf, 0xcb, 0x2b, 0x8c, 0xf1,
+    0x19, 0x38, 0x75, 0xc7, 0xc1, 0xa6, 0x42, 0x67, 0x14, 0x45, 0x66, 0xdd, 0x9c, 0x09, 0x34, 0x15,
+    0x9d, 0x07, 0x45, 0x47, 0x93, 0xf2, 0xd8, 0xc0, 0x04, 0xe4, 0x6a, 0xc7, 0xcb, 0xe7, 0xbd, 0x5e,
+    0x6f, 0x87, 0x9c, 0x3d, 0xc8, 0x4a, 0x3e, 0xd7, 0x78, 0x71, 0xb7, 0x22, 0x8f, 0x0a, 0x5a, 0x7a,
+    0x06, 0x0f, 0xac, 0xce, 0x58, 0xca, 0x13, 0x58, 0xb8, 0x86, 0xb6, 0x84, 0xae, 0x15, 0xdb, 0x85,
+    0x45, 0x92, 0x78, 0xb0, 0x80, 0x2d, 0xb4, 0x1c, 0x94, 0x6e, 0x16, 0x18, 0x25, 0x31, 0x6b, 0xa8,
+    0x69, 0x22, 0x83, 0xb7, 0x66, 0x05, 0x94, 0x4b, 0x24, 0x66, 0x90, 0xb8, 0xc6, 0xf9, 0x3d, 0x57,
+    0x19, 0x7e, 0x76, 0x53, 0xa1, 0x88, 0x9d, 0x8d, 0xb4, 0xa7, 0x58, 0x28, 0x16, 0xe0, 0xe7, 0x47,
+    0x98, 0x88, 0x73, 0x76, 0xef, 0xb9, 0xcc, 0x7c, 0xd9, 0xb1, 0xa9, 0x29, 0xef, 0xd1, 0x39, 0x23,
+    0xee, 0x24, 0xe0, 0x56, 0x95, 0xf2, 0xb8, 0xb7, 0xe6, 0xc5, 0xd3, 0x32, 0xeb, 0xbb, 0x9c, 0x53,
+    0x72, 0xb9, 0xc1, 0x57, 0x99, 0x8c, 0x22, 0xcd, 0x16, 0xba, 0x2c, 0x04, 0xa8, 0x9a, 0xdf, 0x6e,
+    0x58, 0xda, 0x71, 0x46, 0xba, 0x1b, 0x9e, 0xb2, 0xb5, 0x65, 0x59, 0xdb, 0x72, 0xb2, 0xcb, 0xf1,
+    0x53, 0x26, 0x6e, 0x37, 0xbb, 0x27, 0xb9, 0x4c, 0x44, 0x48, 0x9e, 0xbf, 0x78, 0xf1, 0x62, 0xa7,
+    0x64, 0xeb, 0xbd, 0x71, 0x59, 0x98, 0x33, 0x43, 0xf5, 0x96, 0x86, 0x2d, 0x18, 0xce, 0xf7, 0x8a,
+    0x64, 0xc7, 0x68, 0x97, 0x53, 0x7b, 0xa5, 0xe0, 0xa8, 0x71, 0x9e, 0x14, 0x0e, 0xae, 0x35, 0x87,
+    0xd0, 0x3a, 0xf7, 0xb3, 0x75, 0xfa, 0xe1, 0x87, 0x83, 0xdd, 0x8a, 0x18, 0xb6, 0x5d, 0x4f, 0x1b,
+    0xb6, 0x5d, 0x8f, 0xc5, 0xe6, 0x06, 0x5f, 0xa1, 0xb8, 0x23, 0x41, 0xc2, 0xf2, 0x7c, 0x44, 0x5d,
+    0x71, 0x61, 0x1f, 0x76, 0xc5, 0x2e, 0xc2, 0x11, 0x9d, 0xea, 0xd4, 0x8b, 0xe5, 0x9c, 0xd3, 0x62,
+    0x99, 0xcd, 0x2d, 0x4a, 0x64, 0x1a, 0x24, 0x22, 0x78, 0x0b, 0x72, 0xb1, 0x5c, 0xde, 0x60, 0xda,
+    0x35, 0x3f, 0xc0, 0x85, 0x1f, 0xb4, 0xe8, 0xf8, 0xdf, 0xff, 0xf8, 0xfe, 0x9f, 0xc3, 0xb6, 0x45,
+    0xa9, 0x80, 0x5b, 0x85, 0x8a, 0x61, 0xfc, 0x6b, 0x40, 0x8a, 0xc7, 0x16, 0xe9, 0x87, 0x7f, 0xd5,
+    0x23, 0xcd, 0x14, 0xcb, 0xe2, 0x6a, 0x14, 0xf3, 0xc8, 0x22, 0xfc, 0xe5, 0xbb, 0x7a, 0x04, 0x1e,
+    0x0a, 0x2d, 0x55, 0x35, 0x84, 0x7d, 0xe6, 0x30, 0xfe, 0x5e, 0x8f, 0x61, 0x93, 0xba, 0x1a, 0xc3,
+    0x3e, 0x43, 0x8c, 0x9f, 0xfe, 0xf6, 0xd7, 0x9f, 0x7f, 0xfc, 0x7e, 0x03, 0xa5, 0x0d, 0xdc, 0x6f,
+    0x47, 0x00, 0xdb, 0x56, 0x31, 0x06, 0xb9, 0xc2, 0x1f, 0xdd, 0xbd, 0x19, 0x05, 0xb7, 0x5c, 0x10,
+    0xcd, 0x0a, 0x94, 0x46, 0x3b, 0x90, 0x79, 0xcf, 0x14, 0xff, 0x3a, 0x50, 0xb6, 0x9d, 0xb8, 0x70,
+    0x6d, 0x2b, 0xda, 0x2e, 0x43, 0xa3, 0xb2, 0x37, 0xbe, 0x3a, 0x3f, 0x23, 0xa7, 0xd0, 0x98, 0x94,
+    0x4c, 0x40, 0x41, 0x6f, 0x5b, 0x02, 0x4a, 0x12, 0x97, 0x25, 0x6c, 0x0a, 0x98, 0x91, 0x54, 0x70,
+    0x87, 0x8e, 0xbf, 0xe0, 0x61, 0x7f, 0xd8, 0x36, 0xf7, 0xe0, 0x99, 0xad, 0x4e, 0xbd, 0xca, 0x60,
+    0x3a, 0xa7, 0x8b, 0xf9, 0x94, 0x03, 0xad, 0x68, 0x1a, 0x7c, 0xcd, 0x45, 0x3a, 0xa2, 0x30, 0x7a,
+    0xa1, 0x57, 0x8c, 0x68, 0xef, 0xe5, 0x4b, 0x3b, 0x84, 0xf7, 0x09, 0xd8, 0xd7, 0x32, 0xa3, 0xe3,
+    0xcf, 0x14, 0xe7, 0xe9, 0x11, 0x7a, 0x66, 0xbf, 0x44, 0xcf, 0x94, 0x8e, 0x3f, 0x4d, 0x16, 0xfc,
+    0x08, 0x35, 0xd3, 0x27, 0xd4, 0xb8, 0xe4, 0x28, 0x8a, 0x8a, 0x61, 0xad, 0xa0, 0x5c, 0xc2, 0x43,
+    0x20, 0x5c, 0xd3, 0xf1, 0x2d, 0xd7, 0x04, 0xb8, 0xde, 0xcf, 0xa7, 0x4a, 0x11, 0x19, 0x45, 0x74,
+    0x3c, 0x59, 0xa8, 0x94, 0x5c, 0x5f, 0x5c, 0xec, 0x67, 0xcf, 0x86, 0x6f, 0x26, 0x0d, 0x8a, 0xda,
+    0xa9, 0xca, 0x05, 0x74, 0x39, 0x1b, 0xbf, 0x2e, 0x96, 0x10, 0x9b, 0x20, 0x6e, 0xfb, 0x34, 0x6c,
+    0x67, 0xfb, 0x70, 0xa6, 0x88, 0xea, 0xa0, 0xb6, 0x17, 0x39, 0x18, 0x3a, 0xbe, 0x92, 0x0c, 0x5b,
+    0x1b, 0x31, 0xb7, 0x7d, 0xdf, 0xaf, 0xb1, 0xd4, 0x16, 0xd7, 0x53, 0xd8, 0x6e, 0xd5, 0x1e, 0xb8,
+    0xbd, 0x5f, 0x8f, 0xee, 0x12, 0xfc, 0x00, 0xfa, 0xa1, 0x4a, 0xf8, 0x4a, 0x5c, 0x08, 0x2c, 0x05,
+    0x78, 0x72, 0x4c, 0x25, 0xe4, 0xd0, 0x39, 0x21, 0xac, 0xb7, 0x97, 0x67, 0x35, 0xe9, 0xa3, 0xf9,
+    0xbd, 0xb6, 0x11, 0x35, 0x4b, 0x8f, 0x4e, 0xca, 0x0c, 0xee, 0xd3, 0xf1, 0x0d, 0xfc, 0x5d, 0xc2,
+    0xf4, 0xa8, 0x01, 0xcf, 0xdc, 0x63, 0xab, 0xc0, 0x88, 0x1c, 0x93, 0x8e, 0x4b, 0x11, 0x09, 0xcf,
+    0x5c, 0x8e, 0x6f, 0xe1, 0xef, 0xc1, 0xbe, 0xb4, 0x43, 0x12, 0x31, 0xb3, 0x04, 0xdb, 0xd5, 0x7a,
+    0x70, 0x9b, 0x21, 0xeb, 0xd8, 0x7b, 0xc3, 0x70, 0x7a, 0xa5, 0x2c, 0x0d, 0xb8, 0x63, 0x6f, 0xdf,
+    0x06, 0x62, 0x47, 0x97, 0x35, 0x25, 0x48, 0x38, 0x53, 0x5e, 0x22, 0x67, 0xe0, 0xec, 0x29, 0xfe,
+    0x26, 0x57, 0xf0, 0xfb, 0x60, 0x7d, 0x6c, 0xc9, 0x2b, 0x9e, 0x6b, 0xa6, 0xb4, 0x67, 0x77, 0xfe,
+    0xd8, 0x96, 0xcc, 0x35, 0x39, 0x33, 0xd7, 0xb5, 0x35, 0xe3, 0xbe, 0xf2, 0x40, 0x89, 0x4c, 0x8f,
+    0x1b, 0xd1, 0x22, 0xb5, 0x9b, 0x92, 0xb2, 0x7b, 0xe3, 0x49, 0xa3, 0x85, 0xbb, 0x28, 0x19, 0x2c,
+    0xe6, 0x90, 0x7f, 0xfe, 0x37, 0x0b, 0xae, 0x56, 0xb7, 0x3c, 0x01, 0x22, 0xa4, 0xfa, 0x24, 0x49,
+    0x9a, 0xd4, 0x6e, 0xb8, 0x68, 0xcb, 0x87, 0x80, 0x9d, 0xb3, 0x20, 0x6e, 0x66, 0x64, 0x34, 0x26,
+    0x99, 0x6f, 0x6c, 0xbd, 0x12, 0xb9, 0xf6, 0x81, 0x19, 0xd8, 0xb2, 0x35, 0x8b, 0xb9, 0xd9, 0x6a,
+    0x0d, 0x4a, 0xbc, 0x19, 0xd7, 0xe7, 0x09, 0xc7, 0x9f, 0x9f, 0xae, 0x2e, 0x43, 0xa3, 0x8f, 0xfc,
+    0x8e, 0x50, 0xaf, 0x00, 0x2d, 0x51, 0x60, 0xbf, 0x50, 0x42, 0x0c, 0x0e, 0x5a, 0xb4, 0xbd, 0x49,
+    0xde, 0x30, 0x6d, 0x8a, 0xa6, 0x4d, 0xff, 0x3b, 0xd3, 0xcc, 0xa0, 0xa3, 0x60, 0x9c, 0xe1, 0xa4,
+    0xde, 0x30, 0x11, 0x11, 0xeb, 0xc6, 0x68, 0x34, 0x22, 0xb6, 0x35, 0x50, 0xa4, 0x30, 0xe2, 0x3a,
+    0x88, 0x3f, 0xc3, 0xcb, 0x53, 0x5b, 0xcb, 0x4d, 0x58, 0xfc, 0x48, 0x78, 0x92, 0x73, 0xb2, 0x2d,
+    0xe3, 0x26, 0xf2, 0x5a, 0xe8, 0xdc, 0x5c, 0x6f, 0x4a, 0xc1, 0x67, 0x1d, 0xac, 0x0a, 0xdc, 0x42,
+    0xb0, 0x49, 0xdb, 0x4e, 0x7f, 0xc3, 0xd7, 0x31, 0x4f, 0x9b, 0x90, 0x27, 0xc8, 0xc0, 0x83, 0x31,
+    0xf2, 0x19, 0x5c, 0xf9, 0xf2, 0x6d, 0x8b, 0xe8, 0x18, 0xb7, 0x9b, 0x29, 0x5f, 0x92, 0x73, 0xa5,
+    0xa4, 0x6a, 0x7e, 0xfd, 0x7a, 0x32, 0xb9, 0x21, 0xbf, 0x79, 0xc0, 0xe7, 0x90, 0x47, 0x7a, 0x91,
+    0x3f, 0x7e, 0x0d, 0x5a, 0x15, 0xd7, 0xd8, 0x84, 0xf1, 0x2e, 0x96, 0xb3, 0x31, 0xa4, 0x00, 0x36,
+    0xe7, 0x58, 0x83, 0x5c, 0x4b, 0xdf, 0x76, 0x93, 0x6c, 0xf9, 0x22, 0x4d, 0xb9, 0x7a, 0x3d, 0x79,
+    0x73, 0x45, 0x46, 0xe6, 0x34, 0x6c, 0xd1, 0x02, 0x86, 0x76, 0x73, 0xa5, 0x2c, 0x1a, 0x2c, 0x87,
+    0x6d, 0x29, 0xf7, 0xb9, 0x31, 0x8c, 0x1a, 0xfb, 0x48, 0xb2, 0xd9, 0x5f, 0x8b, 0xee, 0xdd, 0xa7,
+    0x27, 0x04, 0x56, 0x1d, 0x0a, 0xe0, 0x21, 0x0b, 0x28, 0xcc, 0x85, 0x0b, 0x26, 0x60, 0xde, 0x10,
+    0x2d, 0x8d, 0x86, 0x6d, 0x78, 0x1f, 0xa7, 0x03, 0x45, 0x1b, 0x07, 0x7b, 0xe4, 0xef, 0xc4, 0x67,
+    0x83, 0xfd, 0x22, 0x92, 0xbf, 0x02, 0xfa, 0x77, 0xe6, 0xc8, 0xfb, 0xe0, 0xdf, 0x42, 0xbe, 0x43,
+    0x00, 0x0e, 0xda, 0x50, 0x11, 0x81, 0x6d, 0x05, 0x35, 0x21, 0x58, 0x64, 0x21, 0xd3, 0xfc, 0x2b,
+    0x68, 0xe6, 0x76, 0x5e, 0x99, 0x00, 0xa0, 0xdd, 0x9a, 0xe0, 0xac, 0x01, 0xe4, 0x5a, 0x7b, 0xcc,
+    0x2c, 0x6a, 0xf9, 0x77, 0x0c, 0xf6, 0x3d, 0x03, 0x27, 0x83, 0xe3, 0xe3, 0x90, 0x8c, 0x19, 0x2f,
+    0x6b, 0x99, 0x22, 0xd0, 0x66, 0x96, 0xd8, 0x21, 0xd1, 0x06, 0x1e, 0xe0, 0xe8, 0xc6, 0x75, 0x2c,
+    0xe1, 0x2c, 0x42, 0x6f, 0xbe, 0x9c, 0xd0, 0x13, 0x77, 0x0a, 0x86, 0x03, 0xe3, 0x03, 0xa1, 0x2e,
+    0x51, 0xbc, 0x09, 0x0c, 0x2f, 0x0a, 0x2b, 0x58, 0x96, 0xc1, 0xa6, 0xd9, 0x6c, 0x48, 0xda, 0x7f,
+    0xca, 0x71, 0xba, 0x3c, 0x9e, 0x98, 0x37, 0x2f, 0x7d, 0xf2, 0x87, 0xdb, 0xeb, 0xcf, 0x21, 0x07,
+    0x14, 0xb0, 0x2d, 0xa2, 0x55, 0xf3, 0xc1, 0x78, 0x74, 0x62, 0x6d, 0x84, 0x68, 0x3d, 0xbe, 0xef,
+    0xc4, 0x42, 0xf5, 0x5b, 0x89, 0x05, 0xd4, 0xb2, 0xed, 0x4c, 0x80, 0x21, 0xd5, 0xa4, 0x66, 0x7b,
+    0x60, 0xdd, 0x75, 0xfc, 0x87, 0x18, 0x7e, 0x5c, 0xdd, 0xc2, 0x37, 0x01, 0x5c, 0x69, 0xb7, 0x08,
+    0xf6, 0x7b, 0x1a, 0xac, 0xcf, 0x09, 0xce, 0xac, 0xd0, 0xa7, 0xad, 0x63, 0xd2, 0x6c, 0x13, 0xde,
+    0xdc, 0x2a, 0x73, 0xcb, 0x61, 0x97, 0x89, 0x62, 0xd5, 0x93, 0x0d, 0x11, 0xa0, 0x14, 0xba, 0x34,
+    0x2c, 0xf7, 0xe7, 0x3c, 0xcf, 0xd9, 0x8c, 0xb7, 0x6a, 0x72, 0x06, 0xb6, 0xa0, 0x1b, 0xc9, 0x02,
+    0xa6, 0x00, 0xb1, 0x2a, 0xe7, 0x97, 0x50, 0xc4, 0xb5, 0xe1, 0x57, 0x45, 0xec, 0xc9, 0xb7, 0xdf,
+    0x92, 0x4e, 0xab, 0xc8, 0x9a, 0xd9, 0x51, 0xc2, 0xb3, 0x6a, 0xe1, 0xe9, 0x51, 0xc2, 0xd3, 0x5d,
+    0xe1, 0x22, 0xf7, 0x80, 0x88, 0xdd, 0x9c, 0xbb, 0xbe, 0x7d, 0x9f, 0x49, 0xa7, 0x4e, 0xc8, 0xec,
+    0x04, 0xac, 0xac, 0xc8, 0xb8, 0x32, 0x69, 0x9e, 0xc8, 0x18, 0x3c, 0x5a, 0xd5, 0x66, 0x0a, 0x3e,
+    0xb4, 0xef, 0xb9, 0x20, 0x5d, 0x8e, 0xcc, 0x91, 0x12, 0xf0, 0xd8, 0x14, 0x01, 0x89, 0x23, 0x52,
+    0x03, 0x6b, 0xe1, 0x3a, 0x8a, 0x8a, 0xdc, 0xf8, 0x5f, 0x91, 0x4c, 0x1f, 0x1e, 0xe9, 0x2f, 0x63,
+    0x13, 0x0d, 0x05, 0xff, 0xe0, 0x74, 0x54, 0x4d, 0x68, 0xf9, 0xfc, 0x1d, 0x18, 0x85, 0xd5, 0x4f,
+    0xd2, 0x69, 0xba, 0x05, 0x2e, 0x3c, 0x8e, 0x50, 0xb3, 0xb7, 0xc5, 0xed, 0xac, 0xe1, 0xd3, 0x34,
+    0x28, 0x53, 0xa7, 0x6a, 0xde, 0xa4, 0x9f, 0x28, 0x4e, 0x56, 0x72, 0x41, 0xf2, 0x85, 0xfb, 0xb1,
+    0x64, 0xa9, 0x46, 0x1d, 0x46, 0x88, 0xb0, 0x24, 0x21, 0xb8, 0x29, 0xfe, 0x98, 0x4c, 0x62, 0x91,
+    0x9b, 0x83, 0x3c, 0x02, 0xb2, 0x34, 0x95, 0x50, 0x35, 0x9c, 0x2c, 0xd2, 0x50, 0xa6, 0x1c, 0xdc,
+    0x6b, 0x11, 0xdb, 0xc4, 0xca, 0xa2, 0x28, 0x77, 0xd4, 0x55, 0x61, 0xfb, 0xbf, 0x76, 0x4e, 0x4b,
+    0x20, 0x5e, 0x3b, 0x59, 0x2c, 0x60, 0x8a, 0x8c, 0x58, 0x37, 0x8f, 0x6e, 0x8b, 0xf6, 0x64, 0x80,
+    0x3e, 0x3d, 0x19, 0xa3, 0x60, 0xbd, 0xf4, 0x88, 0x08, 0xb9, 0xd3, 0x83, 0x3d, 0x2c, 0xbc, 0x4b,
+    0x94, 0x9c, 0x20, 0xd0, 0x05, 0xc7, 0x11, 0x23, 0xfd, 0x71, 0x55, 0x2c, 0xdc, 0xb2, 0x5f, 0x69,
+    0x20, 0xac, 0xdb, 0x85, 0x2f, 0xd0, 0xf4, 0xe0, 0x4c, 0x7d, 0x5c, 0x3c, 0x8a, 0x53, 0xd6, 0x53,
+    0xc1, 0x28, 0x68, 0xb2, 0x14, 0xd5, 0x07, 0x64, 0xdd, 0xfa, 0xe1, 0x44, 0x71, 0x7e, 0x07, 0x3f,
+    0xf0, 0x78, 0xc1, 0x61, 0x87, 0xd4, 0xa4, 0x67, 0xd7, 0x6f, 0x5c, 0x73, 0xc1, 0xf3, 0x3f, 0x0f,
+    0x41, 0x19, 0x04, 0xea, 0xf0, 0x8e, 0xaf, 0x3c, 0xdf, 0xb6, 0x2a, 0x10, 0xcd, 0x8b, 0x3a, 0x80,
+    0xd9, 0xdd, 0x3e, 0x1d, 0xda, 0xbf, 0x15, 0x2f, 0x70, 0x9e, 0xc6, 0x83, 0xd6, 0xf0, 0x14, 0x10,
+    0xbe, 0xd6, 0x39, 0x04, 0x54, 0x36, 0xe2, 0x43, 0x48, 0x1b, 0x27, 0xe7, 0x43, 0x60, 0xeb, 0x26,
+    0x74, 0x08, 0x6b, 0xe7, 0x14, 0x7d, 0x08, 0x6f, 0xab, 0x64, 0x5c, 0x00, 0x87, 0xed, 0xe2, 0x20,
+    0x0d, 0x07, 0x6e, 0xfb, 0x6e, 0xb9, 0x6d, 0xff, 0xcd, 0xf7, 0x1f, 0xcf, 0x73, 0x49, 0xa0, 0xf7,
+    0x1b, 0x00, 0x00,
+};
+static const StaticPage INDEX_HTML_PAGE = {INDEX_HTML_GZ, sizeof(INDEX_HTML_GZ), "\"6382b3d4cda09bc0\""};
+
+// login_html.h: 814 bytes, 414 gzipped
+static const uint8_t LOGIN_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5d, 0x51, 0x41, 0x6e, 0xdb, 0x30,
+    0x10, 0xbc, 0xeb, 0x15, 0x0b, 0x5d, 0x28, 0x21, 0xae, 0x74, 0x77, 0x2d, 0x1f, 0xd2, 0xa6, 0x40,
+    0x8b, 0xa0, 0x09, 0x90, 0xe4, 0x01, 0xb4, 0xb8, 0xb2, 0xd8, 0x50, 0xa4, 0x40, 0x2e, 0x63, 0x08,
+    0x8e, 0xff, 0xde, 0xa5, 0x1c, 0x19, 0x89, 0x2f, 0xd2, 0x72, 0x66, 0x76, 0x39, 0xb3, 0xdc, 0x74,
+    0xce, 0x0f, 0xa0, 0x55, 0x93, 0x1b, 0xb7, 0xd7, 0xf6, 0x17, 0x9f, 0xf2, 0x6d, 0xb6, 0xd1, 0x76,
+    0x8c, 0x04, 0x56, 0x0e, 0xd8, 0xe4, 0xe9, 0x9b, 0xc3, 0x68, 0x64, 0x8b, 0xbd, 0x33, 0x0a, 0x7d,
+    0x93, 0xbf, 0x04, 0xf4, 0x33, 0x7c, 0x25, 0x1d, 0x65, 0x08, 0x39, 0xd0, 0x34, 0x7e, 0xd4, 0x07,
+    0xe7, 0xd5, 0x55, 0xeb, 0xe3, 0x02, 0x73, 0xeb, 0x2e, 0x12, 0x39, 0xfb, 0xa1, 0x0f, 0x71, 0x37,
+    0x68, 0xca, 0xb7, 0xf7, 0xc9, 0xc7, 0xa6, 0x3e, 0x73, 0x2c, 0xaa, 0x93, 0x43, 0xfe, 0x87, 0xd6,
+    0xeb, 0x91, 0xb6, 0x99, 0x72, 0x6d, 0x1c, 0xd0, 0x52, 0xb5, 0x47, 0xba, 0x33, 0x98, 0xca, 0xdb,
+    0xe9, 0xb7, 0x2a, 0xc4, 0x25, 0x80, 0x28, 0x2b, 0xa9, 0xd4, 0xdd, 0x1b, 0x33, 0xf7, 0x3a, 0x10,
+    0x5a, 0xf4, 0x85, 0x38, 0x8f, 0x17, 0x2b, 0x90, 0x61, 0xb2, 0x2d, 0x14, 0x58, 0x42, 0xb3, 0x85,
+    0x63, 0x86, 0xd5, 0xe8, 0x31, 0x49, 0x7f, 0x62, 0x27, 0xa3, 0xa1, 0xa2, 0xfc, 0x9e, 0xb5, 0xce,
+    0x06, 0x82, 0x79, 0x33, 0x0d, 0x60, 0x45, 0xd2, 0xf3, 0x5d, 0x0b, 0x9c, 0x92, 0x32, 0x9c, 0xd8,
+    0x2a, 0xd5, 0xd5, 0x9b, 0x34, 0x11, 0x17, 0x36, 0xa5, 0x5e, 0xd8, 0x54, 0x7f, 0x65, 0x3d, 0x86,
+    0x91, 0x8b, 0xd4, 0x2f, 0x0f, 0x52, 0xf3, 0x1d, 0x48, 0x6d, 0x5f, 0x88, 0x5a, 0x46, 0xea, 0xd9,
+    0xdb, 0x31, 0x1b, 0x90, 0x7a, 0xa7, 0xd6, 0x20, 0x1e, 0x1f, 0x9e, 0x9e, 0xc5, 0x2a, 0xeb, 0x51,
+    0xf2, 0xda, 0xc2, 0x1a, 0x8e, 0x20, 0x7e, 0x38, 0xcb, 0x61, 0xe8, 0xdb, 0x33, 0xef, 0x4b, 0xb0,
+    0x44, 0x8e, 0xa3, 0xd1, 0xad, 0x24, 0xed, 0x6c, 0xfd, 0x2f, 0x38, 0x2b, 0xe0, 0xb4, 0xca, 0x76,
+    0x4e, 0x4d, 0x6b, 0xf8, 0xf3, 0xf4, 0xf0, 0xb7, 0x0a, 0xe4, 0xb5, 0xdd, 0xeb, 0x6e, 0x2a, 0x8e,
+    0xb3, 0xeb, 0xd5, 0xd9, 0xdd, 0xa9, 0xcc, 0x4e, 0xe5, 0x27, 0x47, 0x1c, 0xfa, 0xe2, 0x67, 0x31,
+    0x58, 0xa5, 0x79, 0x69, 0x15, 0xba, 0x83, 0xe2, 0x02, 0xba, 0xd7, 0x92, 0x2d, 0x4a, 0x83, 0x9e,
+    0x0a, 0x31, 0xbf, 0x13, 0x84, 0xd8, 0xb6, 0x18, 0x42, 0x17, 0x8d, 0x60, 0xf5, 0x09, 0xd0, 0x70,
+    0xba, 0x2b, 0x4d, 0x27, 0xb5, 0xc1, 0x94, 0x09, 0x6e, 0xe6, 0x61, 0x7c, 0x61, 0x85, 0xde, 0x3b,
+    0x0f, 0xef, 0xef, 0x20, 0xa2, 0x7d, 0xb5, 0xee, 0x60, 0x61, 0x46, 0x44, 0x99, 0xa6, 0xcc, 0xfe,
+    0x36, 0xf5, 0xf2, 0xe2, 0xff, 0x01, 0x38, 0xad, 0x68, 0xb8, 0xa4, 0x02, 0x00, 0x00,
+};
+static const StaticPage LOGIN_HTML_PAGE = {LOGIN_HTML_GZ, sizeof(LOGIN_HTML_GZ), "\"b4df1d9a4bd59f38\""};
+
+#endif
@@ -9,14 +9,19 @@
 #include "../IService.h"
 #include "../ServiceRegistry.h"
 #include "../eeprom/EEPROMService.h"
+#include "../../scheduler/coro.h"
 #include "../../scheduler/scheduler.h"
 
-class WiFiService : public IService {
+class WiFiService : public ServiceBase<WiFiService> {
 public:
+    static constexpr ServiceId ID = SERVICE_WIFI;
+    static constexpr const char* NAME = "WIFI";
+    typedef ServiceList<EEPROMService> Dependencies;
+
     WiFiService(ServiceRegistry& registry, Scheduler& scheduler, const char* tag = "WiFiService") : registry(registry), scheduler(scheduler), TAG(tag), isReady(false), apMode(false) {}
 
     void start() override {
-        EEPROMService* eeprom = registry.get<EEPROMService>("EEPROM");
+        eeprom = registry.get<EEPROMService>();
         if (!eeprom) {
             Serial.println("WiFiService: EEPROMService not available.");
             isReady = false;
@@ -32,67 +37,16 @@ public:
         ssid[63] = '\0';
         pass[63] = '\0';
 
-        for (int i = 0; i < strlen(ssid); ++i) {
+        for (size_t i = 0; i < strlen(ssid); ++i) {
             if (!isPrintable(ssid[i])) {
                 retriesLeft = 0;
                 break;
             }
         }
 
-        WiFi.disconnect(true);
-        WiFi.setHostname("esp32-device");
-        delay(50);
-
-        if (ssid[0] == '\0') {
-            startAccessPoint();
-            return;
-        }
-
-        WiFi.mode(WIFI_STA);
-        WiFi.begin(ssid, pass);
-        WiFi.setAutoReconnect(true);
-
-        Serial.print("WiFiService: Connecting to SSID: ");
-        Serial.println(ssid);
-
-        for (int i = 0; i < retriesLeft; ++i) {
-            if (WiFi.status() == WL_CONNECTED) {
-                Serial.println("WiFiService: Connected!");
-                Serial.print("Local IP: ");
-                Serial.println(WiFi.localIP());
-
-                // NTP setup
-                configTime(3600, 0, "pool.ntp.org", "time.nist.gov");
-
-                Serial.print("WiFiService: Syncing time via NTP");
-                time_t now = time(nullptr);
-                int retry = 0;
-                while (now < 8 * 3600 * 2 && retry++ < 20) {
-                    delay(500);
-                    Serial.print(".");
-                    now = time(nullptr);
-                }
-                Serial.println();
-
-                if (now < 8 * 3600 * 2) {
-                    Serial.println("WiFiService: NTP sync failed. Time not set.");
-                } else {
-                    Serial.print("WiFiService: Time synced: ");
-                    Serial.println(ctime(&now));
-                }
-
-                isReady = true;
-                apMode = false;
-                return;
-            }
-            Serial.print(".");
-            delay(1000);
-        }
-
-        Serial.println("\nWiFiService: Failed to connect.");
-        clearCredentials(eeprom);
-        delay(1000);
-        ESP.restart();
+        // connect and NTP sync wait on the scheduler so services that don't need the network keep booting
+        if (!connect().start(scheduler, "wifi"))
+            Serial.println("WiFiService: No coroutine frame or task to connect on, WiFi stays down.");
     }
 
     void update(unsigned long) override {
@@ -113,15 +67,21 @@ public:
     }
 
     bool getTime(struct tm* timeInfo) const {
-        return getLocalTime(timeInfo);
+        time_t now = getUnixTime();
+        return isTimeSynced() && localtime_r(&now, timeInfo) != nullptr;
     }
 
     time_t getUnixTime() const {
-        return time(nullptr);
+        return scheduler.clock().unixTime();
     }
 
     bool isTimeSynced() const {
-        return time(nullptr) > 8 * 3600 * 2;
+        return isSyncedTime(getUnixTime());
+    }
+
+    // t was read from a clock NTP had set; before that the clock counts from 1970 at boot
+    static bool isSyncedTime(time_t t) {
+        return t > 8 * 3600 * 2;
     }
 
 
@@ -134,9 +94,68 @@ private:
     char ssid[64] = {0};
     char pass[64] = {0};
     uint8_t retriesLeft = 100;
+    EEPROMService* eeprom = nullptr;
     bool isReady;
     bool apMode;
 
+    Coro connect() {
+        WiFi.disconnect(true);
+        WiFi.setHostname("esp32-device");
+        co_await sleep_for(50);
+
+        if (ssid[0] == '\0') {
+            startAccessPoint();
+            co_return;
+        }
+
+        WiFi.mode(WIFI_STA);
+        WiFi.begin(ssid, pass);
+        WiFi.setAutoReconnect(true);
+
+        Serial.print("WiFiService: Connecting to SSID: ");
+        Serial.println(ssid);
+
+        // one retry used to be one second
+        WaitResult connected{false, false};
+        if (retriesLeft > 0)
+            connected = co_await io([this]() { return WiFi.status() == WL_CONNECTED; }, retriesLeft * 1000UL);
+        if (connected.unscheduled) {
+            // the wait never happened, the credentials are not to blame: start over with them
+            Serial.println("WiFiService: Could not wait for the connection, restarting.");
+            ESP.restart();
+            co_return;
+        }
+        if (!connected) {
+            Serial.println("WiFiService: Failed to connect.");
+            clearCredentials(eeprom);
+            co_await sleep_for(1000);
+            ESP.restart();
+            co_return;
+        }
+
+        Serial.println("WiFiService: Connected!");
+        Serial.print("Local IP: ");
+        Serial.println(WiFi.localIP());
+
+        // NTP setup
+        configTime(3600, 0, "pool.ntp.org", "time.nist.gov");
+
+        Serial.println("WiFiService: Syncing time via NTP");
+        WaitResult synced = co_await until([this]() { return isTimeSynced(); }, 500, 10000);
+        if (synced) {
+            time_t now = getUnixTime();
+            Serial.print("WiFiService: Time synced: ");
+            Serial.println(ctime(&now));
+        } else if (synced.unscheduled) {
+            Serial.println("WiFiService: Could not wait for NTP, time is set once it answers.");
+        } else {
+            Serial.println("WiFiService: NTP sync failed. Time not set.");
+        }
+
+        isReady = true;
+        apMode = false;
+    }
+
     void startAccessPoint() {
         Serial.println("WiFiService: Starting in AP mode.");
 
@@ -151,7 +170,7 @@ private:
         dnsServer.setTTL(3600);
         dnsServer.start(53, "*", apIP);
 
-        scheduler.addTask([this]() {
+        scheduler.addTask("dns", [this]() {
             dnsServer.processNextRequest();
         }, 500, true);
 
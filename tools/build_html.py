@@ -0,0 +1,76 @@
+"""Minifies and gzips the web pages in src/service/webserver/html/*_html.h into html/pages_gz.h, byte arrays the
+firmware sends as they are with Content-Encoding: gzip and a content hash ETag. The *_html.h pages stay the
+sources to edit; run this after changing one and commit both. --check exits 1 if pages_gz.h is out of date.
+
+    python3 tools/build_html.py [--check]
+"""
+
+import gzip
+import hashlib
+import pathlib
+import re
+import sys
+
+HTML_DIR = pathlib.Path(__file__).resolve().parent.parent / "src" / "service" / "webserver" / "html"
+OUTPUT = HTML_DIR / "pages_gz.h"
+PAGE = re.compile(r'const char (\w+)\[\] PROGMEM = R"rawliteral\((.*?)\)rawliteral";', re.S)
+
+
+def minify(html: str) -> str:
+    """Whitespace and comments only, nothing that needs to understand the scripts: indentation, blank lines,
+    HTML comments and lines that are a // comment. No page has a multi-line string literal this would change."""
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    lines = (line.strip() for line in html.splitlines())
+    return "\n".join(line for line in lines if line and not line.startswith("// ") and line != "//") + "\n"
+
+
+def generate() -> str:
+    out = [
+        "// Generated by tools/build_html.py from the *_html.h pages next to it: minified and gzipped, served with",
+        "// Content-Encoding: gzip. Do not edit, change the page and run python3 tools/build_html.py",
+        "#ifndef PAGES_GZ_H",
+        "#define PAGES_GZ_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "struct StaticPage {",
+        "    const uint8_t* gz;",
+        "    size_t length;",
+        "    const char* etag;  // hash of the gzip, changes with the page and nothing else",
+        "};",
+        "",
+    ]
+    for source in sorted(HTML_DIR.glob("*_html.h")):
+        match = PAGE.search(source.read_text(encoding="utf-8").replace("\r\n", "\n"))
+        if not match:
+            raise SystemExit(f"{source.name}: no rawliteral page")
+        name, html = match.groups()
+        data = gzip.compress(minify(html).encode("utf-8"), 9, mtime=0)
+        etag = hashlib.sha256(data).hexdigest()[:16]
+        out.append(f"// {source.name}: {len(html.encode('utf-8'))} bytes, {len(data)} gzipped")
+        out.append(f"static const uint8_t {name}_GZ[] PROGMEM = {{")
+        for i in range(0, len(data), 16):
+            out.append("    " + " ".join(f"0x{b:02x}," for b in data[i:i + 16]))
+        out.append("};")
+        out.append(f'static const StaticPage {name}_PAGE = {{{name}_GZ, sizeof({name}_GZ), "\\"{etag}\\""}};')
+        out.append("")
+    out.append("#endif")
+    return "\r\n".join(out) + "\r\n"
+
+
+def main() -> int:
+    text = generate()
+    current = OUTPUT.read_bytes().decode("utf-8") if OUTPUT.exists() else ""
+    if "--check" in sys.argv[1:]:
+        if current != text:
+            print(f"{OUTPUT} is out of date, run python3 tools/build_html.py")
+            return 1
+        return 0
+    if current != text:
+        OUTPUT.write_bytes(text.encode("utf-8"))
+        print(f"wrote {OUTPUT}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())